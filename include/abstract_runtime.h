@@ -14,6 +14,8 @@
 constexpr int SCREEN_20_COLUMN = 0;   // 20 columns × 14px + margins = ~320x400
 constexpr int SCREEN_40_COLUMN = 1;   // 40 columns × 14px + margins = ~600x500  
 constexpr int SCREEN_80_COLUMN = 2;   // 80 columns × 14px + margins = ~1160x700
+constexpr int SCREEN_132_COLUMN = 3;  // 132x50 grid, 8x12 cells + margins = 1136x700
+constexpr int SCREEN_200_COLUMN = 4;  // 200x60 grid, 8x12 cells + margins = 1680x820
 
 // Legacy constants for compatibility
 constexpr int SCREEN_640x480 = 0;
@@ -57,13 +59,30 @@ constexpr uint32_t COLOR_YELLOW = 0xFFFF00FF;
 constexpr uint32_t COLOR_GRAY = 0x808080FF;
 constexpr uint32_t COLOR_TRANSPARENT = 0x00000000;
 
+// =============================================================================
+// TILE CELL CONSTANTS
+// =============================================================================
+
+// Map cells are 16 bits: a tile ID in the low byte plus flags
+constexpr int TILE_ID_MASK = 0x00FF;   // Tile ID (looked up in the tile palette)
+constexpr int TILE_FLIP_X = 0x0100;    // Draw mirrored horizontally
+constexpr int TILE_FLIP_Y = 0x0200;    // Draw mirrored vertically
+constexpr int TILE_ROTATE = 0x0400;    // Draw rotated 90 degrees clockwise (after flips)
+constexpr int TILE_SOLID = 0x0800;     // Game flag, ignored when drawing
+
+// Tile layers are drawn in index order, layer 0 furthest back
+constexpr int MAX_TILE_LAYERS = 8;
+constexpr int TILE_LAYER_BACK = 0;     // Layer used by the back tile API
+constexpr int TILE_LAYER_FRONT = 1;    // Layer used by the front tile API
+
 // =============================================================================
 // CORE RUNTIME MANAGEMENT
 // =============================================================================
 
 /**
  * Initialize the abstract runtime system
- * @param screen_mode One of SCREEN_20_COLUMN, SCREEN_40_COLUMN, SCREEN_80_COLUMN (or legacy constants)
+ * @param screen_mode One of SCREEN_20_COLUMN, SCREEN_40_COLUMN, SCREEN_80_COLUMN,
+ *                    SCREEN_132_COLUMN, SCREEN_200_COLUMN (or legacy constants)
  * @return true on success, false on failure
  */
 bool init_abstract_runtime(int screen_mode);
@@ -342,6 +361,26 @@ int get_screen_width();
  */
 int get_screen_height();
 
+/**
+ * Override the text grid dimensions of the next screen mode
+ * Must be called before init_abstract_runtime(); the mode still decides
+ * the cell size and font. Pass 0 for either value to use the mode default.
+ * A grid too large for an 8192 pixel window in the chosen mode is reduced
+ * to fit when the runtime starts.
+ *
+ * @param columns Text columns (0 = mode default)
+ * @param rows Text rows (0 = mode default)
+ * @return true if accepted, false if already initialized or out of range
+ */
+bool set_text_grid_size(int columns, int rows);
+
+/**
+ * Get the current text grid dimensions
+ * @param columns Pointer to store column count (may be NULL)
+ * @param rows Pointer to store row count (may be NULL)
+ */
+void get_text_grid_size(int* columns, int* rows);
+
 // =============================================================================
 // TEXT SYSTEM
 // =============================================================================
@@ -391,30 +430,151 @@ void get_text_buffer_cell(int x, int y, uint32_t* text, uint32_t* ink, uint32_t*
  */
 void set_text_buffer_cell(int x, int y, uint32_t text, uint32_t ink, uint32_t paper);
 
+// Field mask for TextCellWrite
+constexpr uint32_t TEXT_WRITE_CHAR = 1;
+constexpr uint32_t TEXT_WRITE_INK = 2;
+constexpr uint32_t TEXT_WRITE_PAPER = 4;
+constexpr uint32_t TEXT_WRITE_ALL = TEXT_WRITE_CHAR | TEXT_WRITE_INK | TEXT_WRITE_PAPER;
+
+/**
+ * One cell of a bulk text write
+ */
+struct TextCellWrite {
+    int x;
+    int y;
+    uint32_t codepoint;  // Unicode codepoint
+    uint32_t ink;        // Ink color (0xRRGGBBAA)
+    uint32_t paper;      // Paper color (0xRRGGBBAA)
+    uint32_t mask;       // TEXT_WRITE_* fields to apply
+};
+
+/**
+ * Apply a list of cell writes in one critical section
+ * Much cheaper than calling print_at/poke_text_* per cell: the text lock
+ * is taken once and dirty state is updated in the same pass.
+ * Cells outside the grid are skipped.
+ *
+ * @param cells Array of cell writes
+ * @param count Number of entries in cells
+ * @return Number of cells written
+ */
+int write_text_cells(const TextCellWrite* cells, int count);
+
+/**
+ * Write a rectangular block of cells in one critical section
+ * Arrays are row-major, width * height entries. Pass NULL for a plane to
+ * leave it unchanged; a codepoint of 0 keeps that cell's character.
+ * The block is clipped to the text grid.
+ *
+ * @param x Left column
+ * @param y Top row
+ * @param width Block width in cells
+ * @param height Block height in cells
+ * @param codepoints Unicode codepoints (may be NULL)
+ * @param ink Ink colors, 0xRRGGBBAA (may be NULL)
+ * @param paper Paper colors, 0xRRGGBBAA (may be NULL)
+ */
+void write_text_block(int x, int y, int width, int height,
+                      const uint32_t* codepoints,
+                      const uint32_t* ink,
+                      const uint32_t* paper);
+
 /**
  * Clear the entire text screen
  */
 void clear_text();
 
 /**
- * Scroll text content by pixel offset
- * @param dx Horizontal pixel offset (not implemented)
+ * Scroll text content smoothly by pixel offset
+ * The offset is applied to the whole grid when it is drawn. Each time a
+ * full row has scrolled past, the row ring advances and only the newly
+ * exposed (blank) row is rasterised.
+ * @param dx Horizontal pixel offset (positive = right)
  * @param dy Vertical pixel offset (positive = down, negative = up)
  */
 void scroll_text(int dx, int dy);
 
 /**
- * Scroll text up by one line (efficient memcpy-based)
+ * Scroll text by whole lines (ring-buffer row mapping, no copying)
+ * @param lines Lines to scroll (positive = down, negative = up)
+ */
+void scroll_text_lines(int lines);
+
+/**
+ * Get the current fine scroll offset left over by scroll_text()
+ * @param dx Pointer to store horizontal offset in pixels (may be NULL)
+ * @param dy Pointer to store vertical offset in pixels (may be NULL)
+ */
+void get_text_scroll_offset(int* dx, int* dy);
+
+/**
+ * Scroll text up by one line (ring-buffer row mapping)
  * Top line disappears, bottom line becomes empty
  */
 void scroll_text_up();
 
 /**
- * Scroll text down by one line (efficient memcpy-based)  
+ * Scroll text down by one line (ring-buffer row mapping)
  * Bottom line disappears, top line becomes empty
  */
 void scroll_text_down();
 
+/**
+ * Append a line of text at the bottom of the screen, terminal style
+ * Scrolls the grid up one line (the top line goes to the scrollback, if
+ * enabled) and writes the text in the current colors. Long lines wrap and
+ * embedded newlines start a new line.
+ * @param utf8_text UTF-8 encoded text
+ */
+void append_text_line(const char* utf8_text);
+
+// =============================================================================
+// TEXT SCROLLBACK
+// =============================================================================
+
+/**
+ * Enable a scrollback ring that keeps lines scrolled off the top
+ * Memory is bounded: lines * columns cells (12 bytes each). Any stored
+ * history is discarded. May be called before or after init.
+ * @param lines Maximum history lines (0 = disable)
+ * @return true on success
+ */
+bool set_text_scrollback_size(int lines);
+
+/**
+ * Get the configured scrollback capacity in lines
+ */
+int get_text_scrollback_size();
+
+/**
+ * Get the number of history lines currently stored
+ */
+int get_text_scrollback_count();
+
+/**
+ * Page the visible window back into the scrollback
+ * The cursor is hidden while viewing history; writes still go to the
+ * live grid and show up once the view returns to 0.
+ * @param lines_back Lines above the live screen (0 = live, clamped to history)
+ */
+void set_text_scrollback_view(int lines_back);
+
+/**
+ * Get how many lines the visible window is paged back
+ */
+int get_text_scrollback_view();
+
+/**
+ * Move the visible window by whole screens
+ * @param pages Screens to move (positive = back into history, negative = forward)
+ */
+void page_text_scrollback(int pages);
+
+/**
+ * Discard all scrollback history and return to the live view
+ */
+void clear_text_scrollback();
+
 /**
  * Set current text foreground (ink) color for new text
  * @param r Red component (0-255)
@@ -686,17 +846,38 @@ bool load_sprite(int slot, const char* filename);
 
 /**
  * Create or update a sprite instance
- * @param instance_id Instance ID (0-127)
+ * Instances live in a pool that grows as needed. Any ID from 0 up to about
+ * a million can be chosen by the caller; IDs returned by sprite_create()
+ * also carry a generation, so they stop working once destroyed.
+ * @param instance_id Instance ID
  * @param sprite_slot Sprite slot from bank (0-511)
  * @param x X position in pixels
  * @param y Y position in pixels
- * @return true on success
+ * @return true on success (false if the ID belongs to another live instance)
  */
 bool sprite(int instance_id, int sprite_slot, int x, int y);
 
+/**
+ * Create a visible sprite instance with a runtime-assigned ID
+ * @param sprite_slot Sprite slot from bank (0-511)
+ * @param x X position in pixels
+ * @param y Y position in pixels
+ * @return Instance ID, or -1 on failure
+ */
+int sprite_create(int sprite_slot, int x, int y);
+
+/**
+ * Destroy a sprite instance and release its ID
+ * IDs from sprite_create() are not reused until the index has cycled
+ * through its generations, so stale IDs fail instead of touching a new sprite.
+ * @param instance_id Instance ID
+ * @return true if the instance existed
+ */
+bool sprite_destroy(int instance_id);
+
 /**
  * Move existing sprite instance
- * @param instance_id Instance ID (0-127)
+ * @param instance_id Instance ID
  * @param x New X position
  * @param y New Y position
  * @return true on success
@@ -705,7 +886,7 @@ bool sprite_move(int instance_id, int x, int y);
 
 /**
  * Scale sprite instance
- * @param instance_id Instance ID (0-127)
+ * @param instance_id Instance ID
  * @param scale_x Horizontal scale factor
  * @param scale_y Vertical scale factor
  * @return true on success
@@ -714,7 +895,7 @@ bool sprite_scale(int instance_id, float scale_x, float scale_y);
 
 /**
  * Rotate sprite instance
- * @param instance_id Instance ID (0-127)
+ * @param instance_id Instance ID
  * @param degrees Rotation in degrees
  * @return true on success
  */
@@ -722,7 +903,7 @@ bool sprite_rotate(int instance_id, float degrees);
 
 /**
  * Set sprite transparency
- * @param instance_id Instance ID (0-127)
+ * @param instance_id Instance ID
  * @param alpha Alpha value (0.0 = transparent, 1.0 = opaque)
  * @return true on success
  */
@@ -730,29 +911,71 @@ bool sprite_alpha(int instance_id, float alpha);
 
 /**
  * Set sprite Z-order for layering
- * @param instance_id Instance ID (0-127)
+ * @param instance_id Instance ID
  * @param z_order Z order (lower = behind, higher = in front)
  * @return true on success
  */
 bool sprite_z_order(int instance_id, int z_order);
 
+/**
+ * One entry of a bulk sprite update (24 bytes, no padding)
+ */
+struct SpriteTransform {
+    int32_t id;      // Instance ID
+    float x;         // X position in pixels
+    float y;         // Y position in pixels
+    float rotation;  // Rotation in degrees
+    float scale;     // Uniform scale factor
+    float alpha;     // Alpha value (0.0 - 1.0)
+};
+
+/**
+ * Update many visible sprites in one step
+ * Much cheaper than sprite_move/sprite_rotate/... per sprite: the sprite
+ * lock is taken once and the renderer sees all the updates in the same
+ * frame. Pass NULL for an array to leave that property unchanged. Entries
+ * with a hidden or unknown ID, or an invalid value, are skipped.
+ *
+ * @param ids Instance IDs
+ * @param xs X positions (may be NULL)
+ * @param ys Y positions (may be NULL)
+ * @param rotations Rotations in degrees (may be NULL)
+ * @param scales Uniform scale factors (may be NULL)
+ * @param alphas Alpha values (may be NULL)
+ * @param count Number of entries in each array
+ * @return Number of sprites updated
+ */
+int sprite_update_many(const int* ids, const float* xs, const float* ys,
+                       const float* rotations, const float* scales,
+                       const float* alphas, int count);
+
+/**
+ * Update many visible sprites from a packed array, as sprite_update_many()
+ * Has C linkage so LuaJIT scripts can call it through ffi.C with a
+ * type-checked SpriteTransform array.
+ * @param transforms Array of updates (every field is applied)
+ * @param count Number of entries in transforms
+ * @return Number of sprites updated
+ */
+extern "C" int sprite_update_transforms(const SpriteTransform* transforms, int count);
+
 /**
  * Hide sprite instance
- * @param instance_id Instance ID (0-127)
+ * @param instance_id Instance ID
  * @return true on success
  */
 bool sprite_hide(int instance_id);
 
 /**
  * Show sprite instance
- * @param instance_id Instance ID (0-127)
+ * @param instance_id Instance ID
  * @return true on success
  */
 bool sprite_show(int instance_id);
 
 /**
  * Check if sprite instance is visible
- * @param instance_id Instance ID (0-127)
+ * @param instance_id Instance ID
  * @return true if visible
  */
 bool sprite_is_visible(int instance_id);
@@ -764,16 +987,36 @@ void hide_all_sprites();
 
 /**
  * Get number of active sprite instances
- * @return Number of active sprites (0-128)
+ * @return Number of visible sprites
  */
 int get_active_sprite_count();
 
+/**
+ * Start a batch of sprite updates
+ * Until the matching commit_sprite_updates, sprite changes are held back
+ * from the renderer so that per-sprite calls (sprite_move, sprite_rotate,
+ * ...) made for one frame appear together. Batches are shared by all
+ * threads and nest; only the outermost commit publishes.
+ */
+void begin_sprite_updates();
+
+/**
+ * End a batch of sprite updates and publish its changes as one frame
+ */
+void commit_sprite_updates();
+
+/**
+ * Get the number of sprite snapshots published to the renderer
+ * @return Publish count (wraps around)
+ */
+unsigned int get_sprite_publish_count();
+
 // =============================================================================
-// TILE SYSTEM API - DUAL LAYER SUPPORT
+// TILE SYSTEM API - PARALLAX LAYER SUPPORT
 // =============================================================================
 
 /**
- * Initialize the tile system (both front and back layers)
+ * Initialize the tile system (every drawn layer, see set_tile_layer_count)
  * Must be called before using any tile functions
  * @return true on success, false on failure
  */
@@ -787,6 +1030,258 @@ bool init_tiles();
  */
 bool load_tile(int tile_id, const char* filename);
 
+/**
+ * Choose which loaded tile image is drawn for a tile ID (both layers)
+ * Cells keep their IDs, so a whole map can be re-skinned (e.g. day/night)
+ * by changing palette entries; only the visible windows are redrawn.
+ * The palette starts as the identity mapping.
+ * @param tile_id Tile ID stored in map cells (1-255)
+ * @param image_id Tile image loaded with load_tile (1-255, 0 = draw nothing)
+ */
+void set_tile_palette_entry(int tile_id, int image_id);
+
+/**
+ * Get the tile image drawn for a tile ID
+ * @param tile_id Tile ID (0-255)
+ * @return Tile image ID
+ */
+int get_tile_palette_entry(int tile_id);
+
+/**
+ * Restore the identity tile palette
+ */
+void reset_tile_palette();
+
+/**
+ * Animate a tile ID through a looping sequence of tile images
+ * The runtime swaps the ID's palette entry as frames change, so every cell
+ * using the ID animates without map edits; only visible cells are redrawn.
+ * Redefining an animation restarts it.
+ * @param tile_id Tile ID stored in map cells (1-255)
+ * @param frames Tile image per frame (see load_tile)
+ * @param durations_ms Display time of each frame in milliseconds
+ * @param frame_count Number of frames
+ * @return true on success
+ */
+bool define_tile_animation(int tile_id, const int* frames, const int* durations_ms, int frame_count);
+
+/**
+ * Stop animating a tile ID (its palette entry is drawn again)
+ * @param tile_id Tile ID (1-255)
+ */
+void clear_tile_animation(int tile_id);
+
+/**
+ * Stop all tile animations
+ */
+void clear_tile_animations();
+
+// =============================================================================
+// TILE LAYERS - Per-layer maps, scrolling and parallax
+// =============================================================================
+
+/**
+ * Start a batch of tile edits on the calling thread
+ * Until the matching commit_tile_edits, map edits (set, fill, clear) and
+ * scroll changes made by this thread are held back, then shown together
+ * in one frame. Reads such as get_tile see batched edits only after the
+ * commit. Batches may nest; the outermost commit applies them.
+ */
+void begin_tile_edits();
+
+/**
+ * Apply the calling thread's batched tile edits between two frames
+ */
+void commit_tile_edits();
+
+/**
+ * Set how many tile layers are drawn (default 2: back and front)
+ * Layers are drawn back to front in index order. Layers enabled after
+ * init_tiles get a map of their set size, or the front layer's size.
+ * @param count Number of layers (1 to MAX_TILE_LAYERS)
+ * @return true on success
+ */
+bool set_tile_layer_count(int count);
+
+/**
+ * Get the number of tile layers drawn
+ */
+int get_tile_layer_count();
+
+/**
+ * Set a layer's world map size, dropping its contents
+ * @param layer Layer index (0 to MAX_TILE_LAYERS - 1)
+ * @param width World map width in tiles
+ * @param height World map height in tiles
+ * @return true on success
+ */
+bool set_tile_layer_map_size(int layer, int width, int height);
+
+/**
+ * Get a layer's world map size
+ * @param layer Layer index
+ * @param width Pointer to store width in tiles
+ * @param height Pointer to store height in tiles
+ */
+void get_tile_layer_map_size(int layer, int* width, int* height);
+
+/**
+ * Set tile at grid position on a layer
+ * @param layer Layer index
+ * @param grid_x Grid X coordinate
+ * @param grid_y Grid Y coordinate
+ * @param tile_id Tile ID plus optional TILE_* flags
+ */
+void set_layer_tile(int layer, int grid_x, int grid_y, int tile_id);
+
+/**
+ * Get tile at grid position on a layer
+ * @param layer Layer index
+ * @param grid_x Grid X coordinate
+ * @param grid_y Grid Y coordinate
+ * @return Cell value: tile ID (0 = empty) plus any flag bits
+ */
+int get_layer_tile(int layer, int grid_x, int grid_y);
+
+/**
+ * Fill rectangular area of a layer with tiles
+ * @param layer Layer index
+ * @param start_x Starting X coordinate
+ * @param start_y Starting Y coordinate
+ * @param width Width in tiles
+ * @param height Height in tiles
+ * @param tile_id Tile ID to fill with
+ */
+void fill_layer_tiles(int layer, int start_x, int start_y, int width, int height, int tile_id);
+
+/**
+ * Clear all tiles of a layer
+ * @param layer Layer index
+ */
+void clear_layer_tiles(int layer);
+
+/**
+ * Write a rectangle of cells to a layer in one edit
+ * Cells outside the map are skipped. The data is copied, so the buffer can
+ * be reused as soon as the call returns.
+ * @param layer Layer index
+ * @param start_x Left column
+ * @param start_y Top row
+ * @param width Width in tiles
+ * @param height Height in tiles
+ * @param cells Row-major buffer of width * height cells (tile ID plus flags)
+ */
+void write_layer_tiles(int layer, int start_x, int start_y, int width, int height, const uint16_t* cells);
+
+/**
+ * Read a rectangle of a layer's cells
+ * Cells outside the map read as 0. Edits staged in an open batch are not
+ * visible until it is committed.
+ * @param layer Layer index
+ * @param start_x Left column
+ * @param start_y Top row
+ * @param width Width in tiles
+ * @param height Height in tiles
+ * @param cells Receives width * height cells in row-major order
+ */
+void read_layer_tiles(int layer, int start_x, int start_y, int width, int height, uint16_t* cells);
+
+/**
+ * Copy a rectangle of a layer to another position
+ * Source and destination may overlap; the result is as if the source had
+ * been read completely before anything was written.
+ * @param layer Layer index
+ * @param src_x Source left column
+ * @param src_y Source top row
+ * @param width Width in tiles
+ * @param height Height in tiles
+ * @param dest_x Destination left column
+ * @param dest_y Destination top row
+ */
+void copy_layer_tiles(int layer, int src_x, int src_y, int width, int height, int dest_x, int dest_y);
+
+/**
+ * Move a rectangle of a layer to another position
+ * Like copy_layer_tiles(), then source cells not overwritten are cleared.
+ */
+void move_layer_tiles(int layer, int src_x, int src_y, int width, int height, int dest_x, int dest_y);
+
+/**
+ * Scroll a layer by offset
+ * @param layer Layer index
+ * @param dx X offset in pixels
+ * @param dy Y offset in pixels
+ */
+void scroll_layer_tiles(int layer, float dx, float dy);
+
+/**
+ * Set a layer's absolute scroll position
+ * @param layer Layer index
+ * @param x X position in pixels
+ * @param y Y position in pixels
+ */
+void set_layer_tile_scroll(int layer, float x, float y);
+
+/**
+ * Get a layer's scroll position
+ * @param layer Layer index
+ * @param x Pointer to store X position
+ * @param y Pointer to store Y position
+ */
+void get_layer_tile_scroll(int layer, float* x, float* y);
+
+/**
+ * Set how far a layer moves with the tile camera (default 1.0)
+ * Values below 1.0 make distant layers scroll slower.
+ * @param layer Layer index
+ * @param factor_x Horizontal fraction of camera movement
+ * @param factor_y Vertical fraction of camera movement
+ */
+void set_tile_layer_parallax(int layer, float factor_x, float factor_y);
+
+/**
+ * Show or hide a layer (hidden layers cost nothing to draw)
+ * @param layer Layer index
+ * @param visible true to draw the layer
+ */
+void set_tile_layer_visible(int layer, bool visible);
+
+/**
+ * Check whether a layer is shown
+ * @param layer Layer index
+ */
+bool is_tile_layer_visible(int layer);
+
+/**
+ * Set a file that a layer's chunks are evicted to
+ * @param layer Layer index
+ * @param path Backing file path, nullptr to keep all chunks in memory
+ * @return true on success
+ */
+bool set_tile_layer_backing_file(int layer, const char* path);
+
+/**
+ * Position the tile camera; every drawn layer scrolls to the camera
+ * position scaled by its parallax factor
+ * @param x Camera X position in pixels
+ * @param y Camera Y position in pixels
+ */
+void set_tile_camera(float x, float y);
+
+/**
+ * Move the tile camera by offset
+ * @param dx X offset in pixels
+ * @param dy Y offset in pixels
+ */
+void scroll_tile_camera(float dx, float dy);
+
+/**
+ * Get the tile camera position
+ * @param x Pointer to store X position
+ * @param y Pointer to store Y position
+ */
+void get_tile_camera(float* x, float* y);
+
 // =============================================================================
 // FRONT TILE LAYER (LAYER_TILES1) - Default/Original API
 // =============================================================================
@@ -795,7 +1290,8 @@ bool load_tile(int tile_id, const char* filename);
  * Set tile at grid position (front layer)
  * @param grid_x Grid X coordinate
  * @param grid_y Grid Y coordinate  
- * @param tile_id Tile ID (0 = empty, 1-255 = loaded tiles)
+ * @param tile_id Tile ID (0 = empty, 1-255 = loaded tiles), optionally
+ *                combined with TILE_FLIP_X, TILE_FLIP_Y, TILE_ROTATE, TILE_SOLID
  */
 void set_tile(int grid_x, int grid_y, int tile_id);
 
@@ -803,7 +1299,7 @@ void set_tile(int grid_x, int grid_y, int tile_id);
  * Get tile at grid position (front layer)
  * @param grid_x Grid X coordinate
  * @param grid_y Grid Y coordinate
- * @return Tile ID (0 = empty)
+ * @return Cell value: tile ID (0 = empty) plus any flag bits
  */
 int get_tile(int grid_x, int grid_y);
 
@@ -822,6 +1318,26 @@ void fill_tiles(int start_x, int start_y, int width, int height, int tile_id);
  */
 void clear_tiles();
 
+/**
+ * Write a rectangle of cells to the front layer (see write_layer_tiles)
+ */
+void write_tiles(int start_x, int start_y, int width, int height, const uint16_t* cells);
+
+/**
+ * Read a rectangle of front layer cells (see read_layer_tiles)
+ */
+void read_tiles(int start_x, int start_y, int width, int height, uint16_t* cells);
+
+/**
+ * Copy a rectangle of the front layer, overlap allowed (see copy_layer_tiles)
+ */
+void copy_tiles(int src_x, int src_y, int width, int height, int dest_x, int dest_y);
+
+/**
+ * Move a rectangle of the front layer (see move_layer_tiles)
+ */
+void move_tiles(int src_x, int src_y, int width, int height, int dest_x, int dest_y);
+
 /**
  * Scroll tiles by offset (front layer)
  * @param dx X scroll delta in pixels
@@ -844,7 +1360,8 @@ void set_tile_scroll(float x, float y);
  * Set tile at grid position (back layer)
  * @param grid_x Grid X coordinate
  * @param grid_y Grid Y coordinate  
- * @param tile_id Tile ID (0 = empty, 1-255 = loaded tiles)
+ * @param tile_id Tile ID (0 = empty, 1-255 = loaded tiles), optionally
+ *                combined with TILE_FLIP_X, TILE_FLIP_Y, TILE_ROTATE, TILE_SOLID
  */
 void set_back_tile(int grid_x, int grid_y, int tile_id);
 
@@ -852,7 +1369,7 @@ void set_back_tile(int grid_x, int grid_y, int tile_id);
  * Get tile at grid position (back layer)
  * @param grid_x Grid X coordinate
  * @param grid_y Grid Y coordinate
- * @return Tile ID (0 = empty)
+ * @return Cell value: tile ID (0 = empty) plus any flag bits
  */
 int get_back_tile(int grid_x, int grid_y);
 
@@ -905,12 +1422,64 @@ void get_tile_scroll(float* x, float* y);
 
 /**
  * Set world map size (must be called before init_tiles)
+ * Maps are stored as sparse 64x64 tile chunks allocated on first write, so
+ * memory follows the area actually edited, not the declared size.
  * @param width World map width in tiles (minimum: viewport width)
  * @param height World map height in tiles (minimum: viewport height)
  * @return true on success, false if tiles already initialized
  */
 bool set_world_map_size(int width, int height);
 
+/**
+ * Open a binary world map file for the tile layers
+ * The file is memory mapped: chunks are paged in on first access and edits
+ * stay private to the process until saved. Replaces every layer's map and
+ * size, and sets the layer count to the number of layers in the file.
+ * May be called before or after init_tiles.
+ * @param path Map file written by save_world_map_file
+ * @return true on success; the current maps are kept on failure
+ */
+bool load_world_map_file(const char* path);
+
+/**
+ * Save the drawn tile layers to a binary world map file
+ * @param path Map file path (replaced atomically)
+ * @param compress true to run-length encode chunks where that is smaller;
+ *                 uncompressed chunks are used in place when the file is opened
+ * @return true on success
+ */
+bool save_world_map_file(const char* path, bool compress);
+
+/**
+ * Set a file that front layer chunks are evicted to
+ * Chunks outside the residency radius are written out when the viewport
+ * shifts and read back when touched again. The file is created or truncated.
+ * @param path Backing file path, nullptr to keep all chunks in memory
+ * @return true on success
+ */
+bool set_world_map_backing_file(const char* path);
+
+/**
+ * Set a file that back layer chunks are evicted to
+ * @param path Backing file path, nullptr to keep all chunks in memory
+ * @return true on success
+ */
+bool set_back_world_map_backing_file(const char* path);
+
+/**
+ * Set how many chunks around the view centre stay resident (default 8)
+ * Only applies to layers with a backing file.
+ * @param chunks Radius in 64-tile chunks (minimum 1)
+ */
+void set_world_map_residency_radius(int chunks);
+
+/**
+ * Get world map chunk counts for all layers
+ * @param resident Pointer to store chunks held in memory (may be null)
+ * @param evicted Pointer to store chunks held in backing files (may be null)
+ */
+void get_world_map_chunk_stats(int* resident, int* evicted);
+
 /**
  * Get world map dimensions
  * @param width Pointer to store world map width
@@ -926,6 +1495,22 @@ void get_world_map_size(int* width, int* height);
 void get_tile_grid_size(int* width, int* height);
 void get_tile_scroll(float* x, float* y);
 
+/**
+ * Choose between GPU atlas tile rendering and Cairo tile composition
+ * The GPU path packs loaded tiles into one atlas texture and draws each
+ * layer's visible window as a single batch. It is the default when the
+ * atlas can be created. Takes effect on the next frame.
+ *
+ * @param enable true to prefer the GPU path, false to force Cairo composition
+ */
+void set_tile_gpu_rendering(bool enable);
+
+/**
+ * Check whether tiles are drawn by the GPU path
+ * @return true if the last frame used the tile atlas
+ */
+bool is_tile_gpu_rendering();
+
 // =============================================================================
 // ENHANCED INPUT SYSTEM
 // =============================================================================
@@ -1065,6 +1650,38 @@ void repl_clear_output();
  */
 void* get_ft_face();
 
+/**
+ * Get glyph cache statistics for the text layer
+ * A miss is the only case where FreeType rasterises a glyph; hits reuse
+ * the cached coverage bitmap.
+ *
+ * @param hits Pointer to store cache hit count (may be NULL)
+ * @param misses Pointer to store cache miss count (may be NULL)
+ * @param cached_glyphs Pointer to store number of cached codepoints (may be NULL)
+ */
+void get_glyph_cache_stats(uint64_t* hits, uint64_t* misses, int* cached_glyphs);
+
+/**
+ * Reset glyph cache hit/miss counters (cached glyphs are kept)
+ */
+void reset_glyph_cache_stats();
+
+/**
+ * Choose between the GPU text path (font atlas, one batched draw per frame)
+ * and the CPU raster path. The GPU path is the default when the font atlas
+ * and shaders initialize; otherwise the CPU path is always used.
+ * Takes effect on the next frame.
+ *
+ * @param enable true to prefer the GPU path, false to force CPU raster
+ */
+void set_text_gpu_rendering(bool enable);
+
+/**
+ * Check whether text is drawn by the GPU path
+ * @return true if the GPU path is enabled and available
+ */
+bool is_text_gpu_rendering();
+
 /**
  * Fill a rectangular area of the color map with specified colors
  * Much more efficient than individual poke calls
@@ -29,6 +29,7 @@ namespace AbstractRuntime {
     struct RuntimeState;
     class LayerRenderer;
     struct Layer;
+    struct SpriteInstance;
     class CommandQueue;
 }
 
@@ -174,6 +175,7 @@ private:
     // Event processing
     CommandQueue* command_queue_;  // Not owned - managed by MainThreadManager
     std::vector<SDL_Event> frame_events_;  // Temporary buffer for draining events
+    std::vector<AbstractRuntime::SpriteInstance> visible_sprites_;  // Reused sprite layer buffer
 
     // Performance tracking
     uint64_t frame_count_ = 0;
@@ -184,7 +186,6 @@ private:
     static constexpr int TILE_SIZE = 64;
     static constexpr int CHAR_WIDTH = 8;
     static constexpr int CHAR_HEIGHT = 16;
-    static constexpr int MAX_SPRITES = 128;
     static constexpr int NUM_LAYERS = 6;
 };
 
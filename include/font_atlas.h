@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -75,6 +76,23 @@ public:
      */
     const CharacterMetrics* get_character(uint32_t codepoint) const;
 
+    /**
+     * Get character metrics, rendering the glyph into the atlas on first use
+     * Codepoints outside the preloaded ranges are added lazily and uploaded
+     * with glTexSubImage2D. Must be called on the thread owning the GL context.
+     * @param codepoint Unicode codepoint
+     * @return Character metrics or nullptr if the font has no such glyph
+     */
+    const CharacterMetrics* get_or_load_character(uint32_t codepoint);
+
+    /**
+     * Get texture coordinates of an opaque texel for solid-colour quads
+     * (cell backgrounds, cursors) drawn from the same atlas texture
+     * @param u Output U coordinate
+     * @param v Output V coordinate
+     */
+    void get_solid_texcoord(float& u, float& v) const { u = solid_u_; v = solid_v_; }
+
     /**
      * Get OpenGL texture ID for the atlas
      * @return OpenGL texture ID
@@ -135,6 +153,7 @@ private:
     
     // Character data
     std::unordered_map<uint32_t, CharacterMetrics> characters_;
+    std::unordered_set<uint32_t> missing_characters_;  // Codepoints the font lacks
     
     // Atlas packing state
     int pack_x_;
@@ -144,6 +163,10 @@ private:
     // Atlas bitmap buffer (for building texture)
     std::vector<uint8_t> atlas_buffer_;
 
+    // Opaque texel used for solid quads
+    float solid_u_;
+    float solid_v_;
+
     /**
      * Load and render a single character to the atlas
      * @param codepoint Unicode codepoint to render
@@ -166,13 +189,25 @@ private:
      * @param glyph_buffer Source bitmap data
      * @param glyph_width Glyph width
      * @param glyph_height Glyph height
+     * @param glyph_pitch Bytes per source row
      * @param atlas_x Destination X in atlas
      * @param atlas_y Destination Y in atlas
      */
     void copy_glyph_to_atlas(const uint8_t* glyph_buffer, 
-                            int glyph_width, int glyph_height,
+                            int glyph_width, int glyph_height, int glyph_pitch,
                             int atlas_x, int atlas_y);
 
+    /**
+     * Reserve an opaque block in the atlas for solid-colour quads
+     * @return true on success
+     */
+    bool reserve_solid_block();
+
+    /**
+     * Upload a rectangle of the atlas buffer to the existing texture
+     */
+    void upload_atlas_region(int x, int y, int width, int height);
+
     /**
      * Upload atlas buffer to GPU texture
      * @return true on success
@@ -0,0 +1,105 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+#include <atomic>
+
+// Forward declarations for FreeType
+using FT_Face = struct FT_FaceRec_*;
+
+namespace AbstractRuntime {
+
+/**
+ * Pre-rendered glyph coverage bitmap.
+ * Coverage is stored tightly packed (width bytes per row), independent
+ * of the FreeType pitch it was copied from.
+ */
+struct CachedGlyph {
+    bool loaded = false;     // FreeType has been asked for this codepoint
+    bool valid = false;      // FreeType produced a glyph (may still be empty)
+    int width = 0;           // Bitmap width in pixels
+    int rows = 0;            // Bitmap height in pixels
+    int left = 0;            // FreeType bitmap_left (offset from pen position)
+    int top = 0;             // FreeType bitmap_top (offset above baseline)
+    std::vector<uint8_t> coverage;  // width * rows alpha values
+};
+
+/**
+ * GlyphCache keeps rasterised glyph coverage for a FreeType face so the
+ * text layer never calls FT_Load_Char for a codepoint it has already seen.
+ *
+ * Lookups for the ranges the text layer uses most (ASCII/Latin-1, box
+ * drawing and block elements, PETSCII private use and the legacy computing
+ * symbols block) go through flat arrays indexed by codepoint; anything else
+ * falls back to a hash map. Not thread safe: call from the render thread.
+ */
+class GlyphCache {
+public:
+    GlyphCache();
+    ~GlyphCache();
+
+    /**
+     * Bind the cache to a FreeType face (pixel size must already be set)
+     * Clears any previously cached glyphs.
+     * @param face FreeType face used for rasterisation
+     */
+    void set_face(FT_Face face);
+
+    /**
+     * Get the coverage bitmap for a codepoint, rasterising it on first use
+     * @param codepoint Unicode codepoint
+     * @return Cached glyph, or nullptr if the font has no usable glyph
+     */
+    const CachedGlyph* get_glyph(uint32_t codepoint);
+
+    /**
+     * Drop every cached glyph (e.g. after changing the face pixel size)
+     */
+    void clear();
+
+    /**
+     * Cache statistics (safe to read from any thread)
+     */
+    uint64_t get_hits() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t get_misses() const { return misses_.load(std::memory_order_relaxed); }
+    size_t get_cached_count() const { return cached_count_.load(std::memory_order_relaxed); }
+    void reset_stats();
+
+private:
+    static constexpr int FLAT_RANGE_SIZE = 256;
+
+    // Flat fast-path ranges, each FLAT_RANGE_SIZE codepoints long
+    static constexpr uint32_t LATIN1_START = 0x0000;    // ASCII + Latin-1
+    static constexpr uint32_t BOX_START = 0x2500;       // Box drawing, blocks, geometric
+    static constexpr uint32_t PETSCII_START = 0xE000;   // PETSCII private use area
+    static constexpr uint32_t LEGACY_START = 0x1FB00;   // Symbols for legacy computing
+
+    FT_Face face_;
+
+    CachedGlyph latin1_[FLAT_RANGE_SIZE];
+    CachedGlyph box_[FLAT_RANGE_SIZE];
+    CachedGlyph petscii_[FLAT_RANGE_SIZE];
+    CachedGlyph legacy_[FLAT_RANGE_SIZE];
+    std::unordered_map<uint32_t, CachedGlyph> other_;
+
+    std::atomic<uint64_t> hits_;
+    std::atomic<uint64_t> misses_;
+    std::atomic<size_t> cached_count_;
+
+    /**
+     * Find the storage slot for a codepoint (creates map entries on demand)
+     */
+    CachedGlyph& slot_for(uint32_t codepoint);
+
+    /**
+     * Rasterise a codepoint through FreeType into a cache slot
+     */
+    void rasterize(uint32_t codepoint, CachedGlyph& glyph);
+};
+
+} // namespace AbstractRuntime
+
+#endif // GLYPH_CACHE_H
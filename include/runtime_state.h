@@ -312,6 +312,8 @@ struct RuntimeState {
     Layer layers[NUM_LAYERS];
     
     // Sprite system (lock-free atomic updates)
+    // The compositor scans every slot each frame, so this stays small;
+    // the main sprite pool lives in SpriteRenderer.
     static constexpr int MAX_SPRITES = 128;
     std::atomic<SpritePosition> sprite_positions[MAX_SPRITES];
     
@@ -0,0 +1,83 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace AbstractRuntime {
+
+/**
+ * SeqLock - Publishes a small value from writers to a lock-free reader
+ *
+ * Readers never block: they copy the value and retry if a write overlapped
+ * the copy, so every load() returns one complete published value, never a
+ * mix of two. Writers must be serialised by the caller (one writer at a
+ * time). Intended for values of a few words that change at most a few
+ * times per frame, such as a layer's scroll position.
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock values must be trivially copyable");
+
+public:
+    SeqLock() : sequence_(0) {
+        T initial = T();
+        store_words(initial);
+    }
+
+    /**
+     * Publish a new value (callers serialise writes)
+     */
+    void store(const T& value) {
+        uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);  // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        store_words(value);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * Read the most recently published value
+     */
+    T load() const {
+        uint32_t copy[WORDS];
+        uint32_t before;
+        uint32_t after;
+        do {
+            before = sequence_.load(std::memory_order_acquire);
+            for (size_t i = 0; i < WORDS; i++) {
+                copy[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence_.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+
+        T value;
+        memcpy(&value, copy, sizeof(T));
+        return value;
+    }
+
+private:
+    static const size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> sequence_;
+    std::atomic<uint32_t> words_[WORDS];
+
+    void store_words(const T& value) {
+        uint32_t copy[WORDS] = {};
+        memcpy(copy, &value, sizeof(T));
+        for (size_t i = 0; i < WORDS; i++) {
+            words_[i].store(copy[i], std::memory_order_relaxed);
+        }
+    }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+};
+
+} // namespace AbstractRuntime
+
+#endif // SEQLOCK_H
@@ -22,7 +22,7 @@ public:
     using ThreadID = uint64_t;
     
     static constexpr SpriteID MIN_SPRITE_ID = 1;
-    static constexpr SpriteID MAX_SPRITE_ID = 128;
+    static constexpr SpriteID MAX_SPRITE_ID = (1u << 20) - 1;  // Sprite renderer instance index space
     static constexpr SpriteID INVALID_SPRITE_ID = 0;
     
     /**
@@ -142,21 +142,25 @@ private:
     // Map sprite ID to owning thread ID (0 = unallocated)
     std::unordered_map<SpriteID, ThreadID> sprite_owners_;
     
-    // Set of available sprite IDs for quick allocation
-    std::unordered_set<SpriteID> available_sprites_;
+    // IDs from next_unused_id_ up have never been handed out; released IDs
+    // go on free_ids_ (entries may be stale after allocateSpecificSprite), so
+    // memory follows the allocated count rather than the ID range
+    SpriteID next_unused_id_ = MIN_SPRITE_ID;
+    std::vector<SpriteID> free_ids_;
     
     // Map thread ID to set of owned sprite IDs
     std::unordered_map<ThreadID, std::unordered_set<SpriteID>> thread_sprites_;
     
     /**
-     * @brief Initialize available sprites set (called once)
+     * @brief Take the next unallocated sprite ID (caller holds mutex_)
+     * @return Sprite ID, or INVALID_SPRITE_ID if every ID is allocated
      */
-    void initializeAvailableSprites();
+    SpriteID takeFreeSprite();
     
     /**
-     * @brief Check if allocator is initialized
+     * @brief Record ownership of an unallocated sprite ID (caller holds mutex_)
      */
-    bool initialized_ = false;
+    void recordOwner(SpriteID sprite_id, ThreadID thread_id);
 };
 
 /**
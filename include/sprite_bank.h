@@ -17,23 +17,51 @@ namespace AbstractRuntime {
  */
 struct SpriteSlot {
     bool occupied = false;
-    GLuint texture_id = 0;
+    GLuint texture_id = 0;  // Atlas page texture (owned by the page)
     int width = 128;
     int height = 128;
     std::string source_file;
     
+    // Placement in the atlas
+    int page = -1;          // Atlas page index
+    int cell = -1;          // Cell on a shared page, -1 for a dedicated page
+    int pixel_x = 0;        // Sprite origin within the page
+    int pixel_y = 0;
+    
     // For deferred texture creation (background thread -> main thread)
     bool needs_texture_creation = false;
     std::vector<unsigned char> png_data;  // RGBA pixel data
     
     SpriteSlot() = default;
-    ~SpriteSlot();
 };
 
 /**
- * SpriteBank manages the sprite texture bank (512 slots).
- * Handles loading PNG files into GPU textures.
+ * Atlas page holding sprite images
+ *
+ * Shared pages are a grid of fixed cells, one sprite per cell. Sprites too
+ * large for a cell get a dedicated page of their own size.
  */
+struct SpriteAtlasPage {
+    GLuint texture_id = 0;
+    int width = 0;
+    int height = 0;
+    bool shared = false;
+    std::vector<int> free_cells;  // Unused cells of a shared page
+};
+
+/**
+ * Texture and coordinates of a loaded sprite, for batched drawing
+ */
+struct SpriteRegion {
+    GLuint texture_id = 0;  // Atlas page texture
+    int width = 0;          // Sprite size in pixels
+    int height = 0;
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = 1.0f;
+    float v1 = 1.0f;
+};
+
 /**
  * Sprite loading request (for main thread processing)
  */
@@ -47,11 +75,21 @@ struct SpriteLoadRequest {
 /**
  * SpriteBank manages the sprite texture bank (512 slots).
  * Handles loading PNG files into GPU textures with proper thread safety.
+ *
+ * Sprites are packed into atlas pages so that many sprites share one
+ * texture: sprites up to CELL_SIZE square take a cell of a shared page, with
+ * a one pixel border repeating their edge pixels so linear filtering never
+ * samples a neighbouring cell. Larger sprites get a dedicated page.
  */
 class SpriteBank {
 public:
     static constexpr int BANK_SIZE = 512;
     static constexpr int DEFAULT_SPRITE_SIZE = 128;
+    static constexpr int PAGE_SIZE = 2048;                      // Shared page size in pixels
+    static constexpr int CELL_SIZE = DEFAULT_SPRITE_SIZE;       // Largest sprite in a shared cell
+    static constexpr int CELL_STRIDE = CELL_SIZE + 2;           // Cell plus its border
+    static constexpr int CELLS_PER_ROW = PAGE_SIZE / CELL_STRIDE;
+    static constexpr int CELLS_PER_PAGE = CELLS_PER_ROW * CELLS_PER_ROW;
 
     SpriteBank();
     ~SpriteBank();
@@ -82,12 +120,26 @@ public:
     void release_sprite(int slot);
 
     /**
-     * Get OpenGL texture ID for slot
+     * Get the atlas page texture holding a slot
+     * The sprite covers only part of the texture; see get_sprite_region().
      * @param slot Slot number
      * @return Texture ID or 0 if invalid
      */
     GLuint get_texture(int slot) const;
 
+    /**
+     * Get the atlas texture, size and texture coordinates of a slot
+     * @param slot Slot number
+     * @param region Output region
+     * @return true if the slot is occupied
+     */
+    bool get_sprite_region(int slot, SpriteRegion& region) const;
+
+    /**
+     * Get the number of atlas pages with a texture
+     */
+    int get_page_count() const;
+
     /**
      * Get texture pixel data for slot
      * @param slot Slot number
@@ -134,6 +186,7 @@ public:
 private:
     bool initialized_;
     SpriteSlot slots_[BANK_SIZE];
+    std::vector<SpriteAtlasPage> pages_;  // Indexed by SpriteSlot::page
     mutable std::mutex bank_mutex_;
     int sprite_count_;
     
@@ -160,10 +213,38 @@ private:
                          int& width, int& height);
 
     /**
-     * Create empty texture for missing sprites
-     * @return OpenGL texture ID
+     * Create placeholder pixels for missing sprites
+     * @return DEFAULT_SPRITE_SIZE square RGBA checkerboard
+     */
+    std::vector<unsigned char> create_empty_pixels() const;
+
+    /**
+     * Create an atlas page texture (caller holds bank_mutex_)
+     * @param shared true for a grid of cells, false for one sprite
+     * @param width Page width in pixels
+     * @param height Page height in pixels
+     * @return Page index or -1 on failure
+     */
+    int create_page(bool shared, int width, int height);
+
+    /**
+     * Upload RGBA pixels into the atlas and record the placement in a slot
+     * (main thread only, caller holds bank_mutex_)
+     * @return true on success
+     */
+    bool place_sprite(int slot, const unsigned char* rgba, int width, int height);
+
+    /**
+     * Return a slot's atlas space to its page (caller holds bank_mutex_)
+     */
+    void free_sprite_region(SpriteSlot& sprite);
+
+    /**
+     * Read a slot's pixels back from its atlas page (caller holds bank_mutex_)
+     * @param sprite Occupied slot
+     * @param data Output RGBA pixel data, width * height * 4 bytes
      */
-    GLuint create_empty_texture();
+    void read_sprite_pixels(const SpriteSlot& sprite, std::vector<unsigned char>& data) const;
 
     /**
      * Actually load PNG file and create OpenGL texture (main thread only)
@@ -1,18 +1,14 @@
 #ifndef SPRITE_RENDERER_H
 #define SPRITE_RENDERER_H
 
+#include "sprite_bank.h"
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <mutex>
 
-// Forward declarations for OpenGL
-typedef unsigned int GLuint;
-
 namespace AbstractRuntime {
 
-// Forward declaration
-class SpriteBank;
-
 /**
  * Sprite instance information
  */
@@ -31,12 +27,38 @@ struct SpriteInstance {
 };
 
 /**
- * SpriteRenderer manages up to 128 active sprite instances.
+ * SpriteRenderer manages a growable pool of sprite instances.
  * Handles positioning, visibility, and rendering of sprites from the sprite bank.
+ *
+ * An instance ID holds an index in its low INDEX_BITS and a generation above
+ * them. IDs picked by the caller have generation 0; sprite_create() hands out
+ * IDs with a non-zero generation from a per-index counter that destroying
+ * an instance advances (and caller-chosen IDs never touch), so stale IDs
+ * are rejected. Live instances are stored densely
+ * with the visible ones first, so a frame only walks the visible set.
+ *
+ * The draw order (z-order, then sprite slot so instances of one sprite sit
+ * together) is kept between frames and only re-sorted when an instance is
+ * shown, hidden, or changes z-order or sprite: by insertion sort for a few
+ * changes, by radix sort for many. Each frame the visible instances are
+ * transformed on the CPU into one vertex array, and each run of instances
+ * on the same atlas page is drawn with a single call.
+ *
+ * The renderer draws a snapshot of the visible instances in draw order,
+ * handed over through a triple buffer. Snapshots are only taken between
+ * complete writes (writers are serialised by writer_mutex_), and never
+ * while an update batch is open: begin_updates() / commit_updates() group
+ * many single-sprite calls so they reach the screen in the same frame, and
+ * committing the outermost batch publishes on the writer's thread. Outside
+ * batches the renderer publishes pending changes at the start of a frame
+ * if try_lock succeeds; otherwise it draws the newest snapshot it has.
  */
 class SpriteRenderer {
 public:
-    static constexpr int MAX_INSTANCES = 128;
+    static constexpr int INDEX_BITS = 20;
+    static constexpr int MAX_INSTANCES = 1 << INDEX_BITS;                 // Instance index space
+    static constexpr int INDEX_MASK = MAX_INSTANCES - 1;
+    static constexpr int MAX_GENERATION = (1 << (31 - INDEX_BITS)) - 1;   // IDs stay positive
 
     SpriteRenderer();
     ~SpriteRenderer();
@@ -57,7 +79,9 @@ public:
 
     /**
      * Create or update a sprite instance
-     * @param instance_id Instance ID (0-127)
+     * A free index is claimed with the ID's generation; an ID whose
+     * generation does not match the live instance is rejected.
+     * @param instance_id Instance ID (index 0 to MAX_INSTANCES - 1, plus generation)
      * @param sprite_slot Sprite slot from bank (0-511)
      * @param x X position in pixels
      * @param y Y position in pixels
@@ -65,6 +89,22 @@ public:
      */
     bool sprite(int instance_id, int sprite_slot, float x, float y);
 
+    /**
+     * Create a visible sprite instance at a free index
+     * @param sprite_slot Sprite slot from bank (0-511)
+     * @param x X position in pixels
+     * @param y Y position in pixels
+     * @return Instance ID (with a non-zero generation), or -1 on failure
+     */
+    int sprite_create(int sprite_slot, float x, float y);
+
+    /**
+     * Destroy a sprite instance and free its index
+     * @param instance_id Instance ID
+     * @return true if the instance existed
+     */
+    bool sprite_destroy(int instance_id);
+
     /**
      * Move existing sprite instance
      * @param instance_id Instance ID
@@ -107,6 +147,24 @@ public:
      */
     bool sprite_z_order(int instance_id, int z_order);
 
+    /**
+     * Update many visible instances under one lock and one publication
+     * Arrays may be NULL to leave a property unchanged; entries that name
+     * a hidden or unknown instance, or carry an invalid value, are skipped.
+     * @param ids Instance IDs
+     * @param xs X positions
+     * @param ys Y positions
+     * @param rotations Rotations in degrees
+     * @param scales Uniform scale factors
+     * @param alphas Alpha values (clamped to 0.0 - 1.0)
+     * @param count Number of entries
+     * @param stride Bytes between entries of every array (0 = tightly packed)
+     * @return Number of instances updated
+     */
+    int sprite_update_many(const int* ids, const float* xs, const float* ys,
+                           const float* rotations, const float* scales,
+                           const float* alphas, int count, size_t stride = 0);
+
     /**
      * Hide sprite instance
      * @param instance_id Instance ID
@@ -139,12 +197,39 @@ public:
      */
     int get_active_count() const;
 
+    /**
+     * Get number of live instances (visible or hidden)
+     */
+    int get_instance_count() const;
+
+    /**
+     * Hold back publication of sprite changes until commit_updates()
+     * Batches nest and are shared by all writer threads.
+     */
+    void begin_updates();
+
+    /**
+     * Close an update batch; the outermost commit publishes all changes
+     * made since begin_updates() as one snapshot
+     */
+    void commit_updates();
+
+    /**
+     * Get the number of snapshots published to the renderer so far
+     */
+    uint32_t get_publish_count() const { return publish_count_.load(std::memory_order_relaxed); }
+
     /**
      * Render all visible sprites to screen
      * This should be called during the render frame cycle
      */
     void render_sprites();
 
+    /**
+     * Get the number of draw calls issued by the last render_sprites()
+     */
+    int get_last_draw_calls() const { return last_draw_calls_; }
+
     /**
      * Update screen dimensions (for window resize)
      * @param width New screen width
@@ -155,18 +240,139 @@ public:
 private:
     bool initialized_;
     SpriteBank* sprite_bank_;
-    SpriteInstance instances_[MAX_INSTANCES];
-    mutable std::mutex renderer_mutex_;
+    mutable std::mutex writer_mutex_;
     int screen_width_;
     int screen_height_;
+
+    // Instance pool - instances_[0, active_count_) are visible, the rest hidden
+    struct InstanceHandle {
+        int32_t dense = -1;        // Position in instances_, -1 when free
+        uint16_t generation = 0;           // Generation of the live instance
+        uint16_t next_generation = 1;      // Next generation sprite_create() hands out
+        bool in_draw_order = false;  // Has an entry in draw_order_
+        bool in_free_list = false;   // Has an entry in free_indices_
+    };
+    std::vector<SpriteInstance> instances_;    // Live instances
+    std::vector<uint32_t> dense_indices_;      // Instance index of each live instance
+    std::vector<InstanceHandle> handles_;      // Indexed by instance index
+    std::vector<uint32_t> free_indices_;       // Released indices (may be stale), each listed once
     int active_count_;
 
+    // Persistent draw order of visible instances (entries of hidden or
+    // destroyed instances are dropped at the next update)
+    struct DrawOrderEntry {
+        uint64_t key;    // Biased z-order in the high word, sprite slot in the low
+        uint32_t index;  // Instance index
+    };
+    static const int INSERTION_SORT_MAX_CHANGES = 64;
+    std::vector<DrawOrderEntry> draw_order_;
+    std::vector<DrawOrderEntry> draw_order_scratch_;  // Radix sort buffer
+    bool draw_order_dirty_;
+    int draw_order_changes_;                          // Keys changed or entries added
+
+    // Triple-buffered snapshots of the visible instances in draw order.
+    // Writers fill snapshots_[back_snapshot_], the renderer reads
+    // snapshots_[front_snapshot_], and ready_snapshot_ holds the third
+    // index plus SNAPSHOT_NEW once a snapshot has been published.
+    static const int SNAPSHOT_NEW = 4;
+    std::vector<SpriteInstance> snapshots_[3];
+    int back_snapshot_;                         // Writers only
+    int front_snapshot_;                        // Render thread only
+    std::atomic<int> ready_snapshot_;
+    std::atomic<bool> snapshot_stale_;          // Writes since the last publish
+    int open_batches_;                          // Update batch depth (writer_mutex_)
+    std::atomic<uint32_t> publish_count_;
+
+    // Per-frame batch, used only by the render thread
+    struct SpriteDraw {
+        SpriteInstance instance;
+        SpriteRegion region;
+    };
+    static const int FLOATS_PER_VERTEX = 8;  // x, y, u, v, r, g, b, a
+    std::vector<SpriteDraw> draws_;
+    std::vector<float> vertices_;
+    std::vector<SpriteRegion> region_cache_;   // Per bank slot, looked up once a frame
+    std::vector<int8_t> region_state_;         // 0 = not looked up, 1 = valid, -1 = invalid
+    int last_draw_calls_;
+
     /**
-     * Validate instance ID
+     * Look up a live instance (caller holds writer_mutex_)
      * @param instance_id Instance ID to check
-     * @return true if valid
+     * @return Instance, or nullptr if the ID is free, stale or out of range
+     */
+    SpriteInstance* find_instance(int instance_id);
+    const SpriteInstance* find_instance(int instance_id) const;
+
+    /**
+     * Add a hidden instance at an index (caller holds writer_mutex_)
+     * @return Position in instances_
+     */
+    int insert_instance(uint32_t index, uint16_t generation);
+
+    /**
+     * Remove the instance at an index and advance its next generation
+     * (caller holds writer_mutex_)
+     */
+    void remove_instance(uint32_t index);
+
+    /**
+     * List an index as free for sprite_create() unless it already is
+     * (caller holds writer_mutex_)
+     */
+    void release_index(uint32_t index);
+
+    /**
+     * Show or hide an instance, moving it across the visible partition
+     * (caller holds writer_mutex_)
+     */
+    void set_instance_active(int dense, bool active);
+
+    /**
+     * Swap two live instances, keeping their handles in step
      */
-    bool is_valid_instance_id(int instance_id) const;
+    void swap_instances(int a, int b);
+
+    /**
+     * Reset an instance's transform for a new sprite and show it
+     */
+    void start_instance(int dense, int sprite_slot, float x, float y);
+
+    /**
+     * Finish a write: mark the published snapshot out of date
+     * (caller holds writer_mutex_)
+     */
+    void note_write() {
+        snapshot_stale_.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * Copy the visible instances in draw order into the back snapshot and
+     * swap it into the ready slot (caller holds writer_mutex_)
+     */
+    void publish_snapshot();
+
+    /**
+     * Take the newest published snapshot for this frame (render thread only)
+     * @return Visible instances in draw order
+     */
+    const std::vector<SpriteInstance>& acquire_snapshot();
+
+    /**
+     * Note that a visible instance's draw key changed (caller holds writer_mutex_)
+     */
+    void mark_draw_order_changed() {
+        draw_order_dirty_ = true;
+        draw_order_changes_++;
+    }
+
+    /**
+     * Drop stale entries and re-sort the draw order if anything changed
+     * (caller holds writer_mutex_)
+     */
+    void update_draw_order();
+    static void insertion_sort_draw_order(std::vector<DrawOrderEntry>& entries);
+    static void radix_sort_draw_order(std::vector<DrawOrderEntry>& entries,
+                                      std::vector<DrawOrderEntry>& scratch);
 
     /**
      * Check if sprite instance is on screen or partially visible
@@ -179,22 +385,17 @@ private:
                            int sprite_width, int sprite_height) const;
 
     /**
-     * Render a single sprite instance
-     * @param instance Sprite instance to render
-     */
-    void render_sprite_instance(const SpriteInstance& instance);
-
-    /**
-     * Render a single sprite instance (optimized - assumes texture already bound)
-     * @param instance Sprite instance to render
+     * Collect the on-screen instances of a snapshot into draws_
+     * @param snapshot Visible instances in draw order
      */
-    void render_sprite_instance_optimized(const SpriteInstance& instance);
+    void collect_visible_sprites(const std::vector<SpriteInstance>& snapshot);
 
     /**
-     * Get sorted list of visible sprites by z-order
-     * @return Vector of instance IDs sorted by z-order
+     * Append an instance's transformed quad to the vertex array
+     * @param instance Sprite instance to draw
+     * @param region Atlas region of its sprite
      */
-    std::vector<int> get_sorted_visible_sprites() const;
+    void append_sprite_quad(const SpriteInstance& instance, const SpriteRegion& region);
 };
 
 } // namespace AbstractRuntime
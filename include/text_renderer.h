@@ -8,6 +8,7 @@
 // Forward declarations for OpenGL
 typedef unsigned int GLuint;
 typedef unsigned int GLenum;
+typedef int GLint;
 
 namespace AbstractRuntime {
 
@@ -22,29 +23,34 @@ struct ViewportOffset;
 struct TextVertex {
     float x, y;           // Screen position
     float tex_x, tex_y;   // Texture coordinates
-    uint32_t color;       // RGBA color
+    uint32_t color;       // RGBA color, stored as bytes R,G,B,A in memory
 };
 
 /**
- * Text render batch for efficient GPU submission
+ * Text render batch for efficient GPU submission.
+ * Vertices are quads (4 per character) drawn with GL_QUADS, which the
+ * OpenGL 2.1 compatibility context supports directly.
  */
 struct TextBatch {
     std::vector<TextVertex> vertices;
-    std::vector<uint16_t> indices;
     GLuint vertex_buffer;
-    GLuint index_buffer;
     int character_count;
-    
+
     TextBatch();
     ~TextBatch();
-    
+
     void clear();
     void upload_to_gpu();
+    void release();
 };
 
 /**
  * TextRenderer handles immediate-mode text rendering using pre-rendered font atlas.
  * Provides instant text display with no rasterization delay.
+ *
+ * The runtime text grid is kept as a persistent vertex buffer with a fixed
+ * slot per cell (paper quad + glyph quad), so changing a cell rewrites eight
+ * vertices and the whole grid is drawn with a single glDrawArrays call.
  */
 class TextRenderer {
 public:
@@ -63,6 +69,58 @@ public:
      */
     void shutdown();
 
+    /**
+     * Check whether the renderer is ready to draw
+     */
+    bool is_initialized() const { return initialized_; }
+
+    /**
+     * Configure the persistent text grid
+     * Reallocates the grid vertex buffer; all cells start empty.
+     * @param cols Grid columns
+     * @param rows Grid rows
+     * @param origin_x Screen X of the top-left cell
+     * @param origin_y Screen Y of the top-left cell
+     * @param cell_width Cell width in pixels
+     * @param cell_height Cell height in pixels
+     * @param baseline Baseline offset from the top of a cell
+     */
+    void set_grid_layout(int cols, int rows, int origin_x, int origin_y,
+                         int cell_width, int cell_height, int baseline);
+
+    /**
+     * Rebuild the vertices for a horizontal span of grid cells
+     * Arrays point at the first cell of the span (row-major SoA storage).
+     * @param row Physical grid row
+     * @param first_col First column of the span
+     * @param count Number of cells in the span
+     * @param codepoints Unicode codepoints for each cell
+     * @param ink Ink colors (0xRRGGBBAA) for each cell
+     * @param paper Paper colors (0xRRGGBBAA) for each cell
+     */
+    void update_grid_cells(int row, int first_col, int count,
+                           const uint32_t* codepoints,
+                           const uint32_t* ink,
+                           const uint32_t* paper);
+
+    /**
+     * Set the ring-buffer row mapping and fine pixel scroll of the grid
+     * Grid rows are stored physically; first_row is the physical row shown
+     * at the top, so scrolling by a whole row only moves this index.
+     * @param first_row Physical row displayed as logical row 0
+     * @param offset_x Horizontal pixel offset applied to the whole grid
+     * @param offset_y Vertical pixel offset applied to the whole grid
+     */
+    void set_grid_scroll(int first_row, float offset_x, float offset_y);
+
+    /**
+     * Draw the persistent text grid (one draw per ring segment)
+     * Only vertices changed since the last call are re-uploaded.
+     * @param screen_width Screen width in pixels
+     * @param screen_height Screen height in pixels
+     */
+    void render_grid(int screen_width, int screen_height);
+
     /**
      * Render text layer to screen
      * @param text_data Text grid data
@@ -70,7 +128,7 @@ public:
      * @param screen_width Screen width in pixels
      * @param screen_height Screen height in pixels
      */
-    void render_text_layer(const TextData& text_data, 
+    void render_text_layer(const TextData& text_data,
                           const ViewportOffset& viewport_offset,
                           int screen_width, int screen_height);
 
@@ -78,11 +136,11 @@ public:
      * Render single text string at position
      * @param text Text string to render
      * @param x Screen X position
-     * @param y Screen Y position  
+     * @param y Screen Y position
      * @param color Text color (RGBA)
      * @param scale Text scale factor
      */
-    void render_text_string(const char* text, int x, int y, 
+    void render_text_string(const char* text, int x, int y,
                            uint32_t color, float scale = 1.0f);
 
     /**
@@ -105,7 +163,7 @@ public:
      * @param height Output height
      * @param scale Text scale factor
      */
-    void measure_text(const char* text, int& width, int& height, 
+    void measure_text(const char* text, int& width, int& height,
                      float scale = 1.0f);
 
     /**
@@ -119,11 +177,10 @@ public:
 
     /**
      * Grid-based text operations (for BCPL compatibility)
+     * Grid positions use the layout set by set_grid_layout().
      */
-    void render_text_at_grid(const char* text, int grid_x, int grid_y, 
+    void render_text_at_grid(const char* text, int grid_x, int grid_y,
                            uint32_t color);
-    void clear_text_grid(int grid_x1, int grid_y1, int grid_x2, int grid_y2);
-    void scroll_text_grid(int delta_x, int delta_y);
 
     /**
      * Font information
@@ -143,29 +200,50 @@ public:
 
 private:
     FontAtlas* font_atlas_;
-    
+
     // OpenGL resources
     GLuint shader_program_;
-    GLuint vertex_array_;
     TextBatch text_batch_;
-    
-    // Shader uniforms
-    GLuint uniform_projection_;
-    GLuint uniform_texture_;
-    GLuint uniform_color_;
-    
+
+    // Shader attribute and uniform locations
+    GLint attrib_position_;
+    GLint attrib_texcoord_;
+    GLint attrib_color_;
+    GLint uniform_projection_;
+    GLint uniform_texture_;
+    GLint uniform_color_;
+    GLint uniform_offset_;
+
     // Rendering state
     bool initialized_;
     bool alpha_blend_enabled_;
     float projection_matrix_[16];
-    
+
+    // Persistent text grid (8 vertices per cell: paper quad, glyph quad)
+    std::vector<TextVertex> grid_vertices_;
+    GLuint grid_vertex_buffer_;
+    int grid_cols_;
+    int grid_rows_;
+    int grid_origin_x_;
+    int grid_origin_y_;
+    int grid_cell_width_;
+    int grid_cell_height_;
+    int grid_baseline_;
+    int grid_dirty_first_;   // First cell needing re-upload (-1 when clean)
+    int grid_dirty_last_;    // Last cell needing re-upload
+    bool grid_buffer_allocated_;
+    int grid_first_row_;     // Physical row drawn at the top of the grid
+    float grid_scroll_x_;    // Fine scroll offset in pixels
+    float grid_scroll_y_;
+
     // Cursor state
     bool cursor_visible_;
     int cursor_x_, cursor_y_;
     uint32_t cursor_color_;
     int cursor_blink_rate_ms_;
     uint64_t cursor_last_blink_time_;
-    
+    bool cursor_blink_state_;
+
     // Performance tracking
     int characters_rendered_;
     float last_render_time_ms_;
@@ -179,28 +257,39 @@ private:
     bool link_program(GLuint vertex_shader, GLuint fragment_shader);
     void destroy_shader_program();
 
+    /**
+     * Bind shader, atlas and vertex attributes for a draw
+     */
+    void begin_draw(GLuint vertex_buffer, int screen_width, int screen_height);
+    void end_draw();
+
     /**
      * Text batching
      */
     void begin_text_batch();
-    void add_character_to_batch(uint32_t codepoint, int x, int y, 
+    void add_character_to_batch(uint32_t codepoint, int x, int y,
                                uint32_t color, float scale);
     void add_quad_to_batch(float x, float y, float w, float h,
                           float tex_x, float tex_y, float tex_w, float tex_h,
                           uint32_t color);
     void flush_text_batch();
 
+    /**
+     * Write one quad into a vertex array (degenerate when w or h <= 0)
+     */
+    static void write_quad(TextVertex* quad, float x, float y, float w, float h,
+                           float tex_x, float tex_y, float tex_w, float tex_h,
+                           uint32_t color);
+
     /**
      * Coordinate conversion
      */
-    void screen_to_ndc(int screen_x, int screen_y, float& ndc_x, float& ndc_y,
-                      int screen_width, int screen_height);
     void grid_to_screen(int grid_x, int grid_y, int& screen_x, int& screen_y);
 
     /**
      * Cursor rendering
      */
-    void render_cursor(int screen_width, int screen_height);
+    void render_cursor();
     bool should_cursor_blink();
 
     /**
@@ -208,6 +297,7 @@ private:
      */
     uint64_t get_time_ms();
     void setup_projection_matrix(int screen_width, int screen_height);
+    static uint32_t to_vertex_color(uint32_t rgba);
 
     // Shader source code
     static const char* vertex_shader_source_;
@@ -215,7 +305,8 @@ private:
 
     // Constants
     static constexpr int MAX_CHARACTERS_PER_BATCH = 1024;
-    static constexpr float DEFAULT_CURSOR_BLINK_RATE = 500.0f; // ms
+    static constexpr int VERTICES_PER_CELL = 8;
+    static constexpr int DEFAULT_CURSOR_BLINK_RATE = 500; // ms
 };
 
 /**
@@ -243,4 +334,4 @@ TextRenderer* get_text_renderer();
 
 } // namespace AbstractRuntime
 
-#endif // TEXT_RENDERER_H
\ No newline at end of file
+#endif // TEXT_RENDERER_H
@@ -0,0 +1,278 @@
+#ifndef TILE_MAP_H
+#define TILE_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace AbstractRuntime {
+
+/**
+ * MappedMapFile - Private, copy-on-write memory mapping of a map file
+ *
+ * Pages are read from disk on first touch. Writes through the mapping go to
+ * private copies and never reach the file; saving writes a new file.
+ */
+class MappedMapFile {
+public:
+    MappedMapFile();
+    ~MappedMapFile();
+
+    /**
+     * Map a file
+     * @param path File to map
+     * @return true on success
+     */
+    bool open(const char* path);
+
+    unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    bool contains(const void* ptr) const {
+        const unsigned char* p = static_cast<const unsigned char*>(ptr);
+        return data_ && p >= data_ && p < data_ + size_;
+    }
+
+private:
+    unsigned char* data_;
+    size_t size_;
+
+    MappedMapFile(const MappedMapFile&) = delete;
+    MappedMapFile& operator=(const MappedMapFile&) = delete;
+};
+
+/**
+ * TileMap - Sparse chunked storage for a tile world map
+ *
+ * Cells are 16 bits: a tile ID in the low byte and flag bits above it.
+ * The map is split into 64x64-tile chunks kept in a hash directory. Chunks
+ * are allocated on the first non-zero write; reads of chunks that were never
+ * written come from a shared all-zero chunk, so memory scales with the
+ * explored area rather than the declared map size.
+ *
+ * With a backing file set, chunks far from the viewport can be evicted to
+ * the file and are read back transparently the next time they are touched.
+ * Maps can also be attached to a memory-mapped map file, whose chunks are
+ * paged in on first access.
+ *
+ * All methods are thread safe; the runtime edits maps on the app thread
+ * while the render thread reads them.
+ */
+class TileMap {
+public:
+    static const int CHUNK_SIZE = 64;                          // Tiles per chunk side
+    static const int CHUNK_TILES = CHUNK_SIZE * CHUNK_SIZE;    // Tiles per chunk
+
+    // Cell layout
+    static constexpr uint16_t ID_MASK = 0x00FF;   // Tile ID (palette index)
+    static constexpr uint16_t FLIP_X = 0x0100;    // Mirror horizontally
+    static constexpr uint16_t FLIP_Y = 0x0200;    // Mirror vertically
+    static constexpr uint16_t ROTATE = 0x0400;    // Rotate 90 degrees clockwise (after flips)
+    static constexpr uint16_t SOLID = 0x0800;     // Game flag, not used for drawing
+
+    // Chunk payload encodings used by map files
+    enum ChunkEncoding {
+        CHUNK_RAW = 0,  // CHUNK_TILES little-endian uint16 cells
+        CHUNK_RLE = 1   // (uint16 count, uint16 cell) runs covering CHUNK_TILES
+    };
+
+    /**
+     * Chunk payload stored in a mapped map file
+     */
+    struct FileChunk {
+        int chunk_x;
+        int chunk_y;
+        uint32_t encoding;
+        const unsigned char* data;
+        size_t size;
+    };
+
+    TileMap();
+    ~TileMap();
+
+    /**
+     * Set the map bounds and drop all contents
+     * No tile storage is allocated until tiles are written.
+     * @param width Map width in tiles
+     * @param height Map height in tiles
+     */
+    void reset(int width, int height);
+
+    /**
+     * Release all chunks, close the backing file and clear the bounds
+     */
+    void release();
+
+    int get_width() const { return width_; }
+    int get_height() const { return height_; }
+    bool is_allocated() const { return width_ > 0 && height_ > 0; }
+
+    /**
+     * Read a cell (0 outside the map or in unwritten chunks)
+     */
+    int get(int x, int y) const;
+
+    /**
+     * Write a cell, truncated to 16 bits (ignored outside the map)
+     */
+    void set(int x, int y, int cell);
+
+    /**
+     * Fill a rectangle, clipped to the map
+     */
+    void fill(int x, int y, int width, int height, int cell);
+
+    /**
+     * Read a rectangle into a row-major buffer with one lock and one chunk
+     * lookup per chunk row segment (cells outside the map read as 0)
+     * @param out Buffer of width * height cells
+     */
+    void read_rect(int x, int y, int width, int height, uint16_t* out) const;
+
+    /**
+     * Write a row-major rectangle of cells, clipped to the map, under one lock
+     * @param cells Buffer of width * height cells
+     */
+    void write_rect(int x, int y, int width, int height, const uint16_t* cells);
+
+    /**
+     * Copy a rectangle to another position in one step (overlap is allowed)
+     * Source cells outside the map copy as 0; destination cells are clipped.
+     * @param move true to clear the source cells not covered by the copy
+     */
+    void copy_rect(int src_x, int src_y, int width, int height, int dest_x, int dest_y, bool move);
+
+    /**
+     * Clear every tile (drops all chunks)
+     */
+    void clear();
+
+    /**
+     * Replace the contents with chunks of a mapped map file
+     * Raw chunks are used in place (edits go to private copy-on-write pages);
+     * compressed chunks are decoded on first access. The mapping is kept
+     * alive until the map is reset or released.
+     * @param width Map width in tiles
+     * @param height Map height in tiles
+     * @param file Mapped file holding the payloads
+     * @param chunks Chunk directory for this map
+     */
+    void attach_file_chunks(int width, int height, std::shared_ptr<MappedMapFile> file,
+                            const std::vector<FileChunk>& chunks);
+
+    /**
+     * Visit every allocated chunk in unspecified order
+     * Evicted and not yet decoded file chunks are brought into memory first.
+     * The map is locked for the duration; the visitor must not call back in.
+     */
+    void for_each_chunk(const std::function<void(int chunk_x, int chunk_y, const uint16_t* cells)>& visit) const;
+
+    /**
+     * Use a file as eviction backing store
+     * Chunks evicted earlier stay readable only while the same file is set.
+     * @param path File to create or truncate, nullptr to disable eviction
+     * @return true on success
+     */
+    bool set_backing_file(const char* path);
+
+    /**
+     * Evict resident chunks further than radius chunks from a tile position
+     * Chunks that are all zero are simply released. Does nothing without a
+     * backing file.
+     * @param center_x Tile column at the centre of interest
+     * @param center_y Tile row at the centre of interest
+     * @param radius Residency radius in chunks (Chebyshev distance)
+     * @return Number of chunks evicted
+     */
+    int evict_outside(int center_x, int center_y, int radius);
+
+    /**
+     * Get chunk counts for memory diagnostics
+     */
+    int get_resident_chunk_count() const;
+    int get_evicted_chunk_count() const;
+
+private:
+    struct Chunk {
+        uint16_t tiles[CHUNK_TILES];
+    };
+
+    int width_;
+    int height_;
+
+    mutable std::mutex mutex_;
+    mutable std::unordered_map<uint64_t, Chunk*> chunks_;      // Resident chunks
+    mutable std::unordered_map<uint64_t, long> evicted_;       // Chunk -> file offset
+    mutable std::unordered_map<uint64_t, FileChunk> file_chunks_;  // Not yet touched map file chunks
+    std::shared_ptr<MappedMapFile> mapped_file_;               // Source of file chunks
+    std::unordered_map<uint64_t, long> file_slots_;            // Chunk -> reusable file offset
+    FILE* backing_;
+    std::string backing_path_;
+    long backing_end_;
+
+    // One-entry lookup cache (consecutive reads usually hit the same chunk)
+    mutable uint64_t cached_key_;
+    mutable Chunk* cached_chunk_;
+
+    static const Chunk zero_chunk_;  // Shared sentinel for unwritten chunks
+
+    static uint64_t chunk_key(int chunk_x, int chunk_y) {
+        return ((uint64_t)(uint32_t)chunk_y << 32) | (uint32_t)chunk_x;
+    }
+
+    const Chunk* find_chunk(int chunk_x, int chunk_y) const;
+    Chunk* get_or_create_chunk(int chunk_x, int chunk_y);
+    Chunk* load_evicted_chunk(uint64_t key) const;
+    Chunk* load_file_chunk(uint64_t key) const;
+    bool is_mapped_chunk(const Chunk* chunk) const {
+        return mapped_file_ && mapped_file_->contains(chunk);
+    }
+    void drop_all_chunks();
+    void fill_unlocked(int x, int y, int width, int height, int cell);
+    void read_rect_unlocked(int x, int y, int width, int height, uint16_t* out) const;
+    void write_rect_unlocked(int x, int y, int width, int height, const uint16_t* cells);
+};
+
+/**
+ * Map file format (little-endian, version 3)
+ *
+ *   header    magic "ARMP", version, layer count, chunk size (64)
+ *   layers    per layer: width, height, chunk count, directory offset
+ *   directory per chunk: chunk x, chunk y, encoding, payload size, offset
+ *   payloads  raw or RLE chunk data, 64-byte aligned
+ *
+ * Layers are stored in tile layer order (layer 0 is drawn furthest back).
+ * Chunks that are entirely empty are not stored.
+ */
+
+/**
+ * Open a map file and attach its layers to maps
+ * @param path Map file path
+ * @param maps Maps receiving file layers 0, 1, ... (replaced)
+ * @param max_layers Number of maps available
+ * @param layer_count Receives the number of layers loaded (may be null)
+ * @return true on success; the maps are unchanged on failure
+ */
+bool load_tile_map_file(const char* path, TileMap* const* maps, int max_layers, int* layer_count);
+
+/**
+ * Write layers to a map file
+ * The file is written beside the target and renamed over it, so a map
+ * currently mapped from the same path stays valid.
+ * @param path Map file path
+ * @param maps Layer maps in order
+ * @param layer_count Number of layers to write
+ * @param compress true to RLE-encode chunks where that is smaller
+ * @return true on success
+ */
+bool save_tile_map_file(const char* path, const TileMap* const* maps, int layer_count, bool compress);
+
+} // namespace AbstractRuntime
+
+#endif // TILE_MAP_H
@@ -0,0 +1,155 @@
+#ifndef TILE_RENDERER_H
+#define TILE_RENDERER_H
+
+#include "tile_map.h"
+#include <cstdint>
+#include <vector>
+
+// Forward declarations for OpenGL
+typedef unsigned int GLuint;
+
+namespace AbstractRuntime {
+
+/**
+ * TileAtlas packs every tile image into one OpenGL texture.
+ *
+ * The atlas is a fixed grid of 128x128 slots, one per tile ID, so a tile's
+ * texture coordinates follow directly from its ID and loading a tile is a
+ * single glTexSubImage2D into its slot. All methods must be called on the
+ * thread that owns the GL context.
+ */
+class TileAtlas {
+public:
+    static const int TILE_SIZE = 128;        // Slot size in pixels
+    static const int MAX_TILES = 256;        // Tile IDs 0-255 (0 = empty)
+    static const int SLOTS_PER_ROW = 16;     // 16 x 16 slots
+    static const int ATLAS_SIZE = TILE_SIZE * SLOTS_PER_ROW;  // 2048 x 2048
+
+    TileAtlas();
+    ~TileAtlas();
+
+    /**
+     * Create the atlas texture (storage allocated once, all slots empty)
+     * @return true on success
+     */
+    bool initialize();
+
+    /**
+     * Release the atlas texture
+     */
+    void shutdown();
+
+    bool is_initialized() const { return texture_ != 0; }
+    GLuint get_texture_id() const { return texture_; }
+
+    /**
+     * Copy a tile image into its slot
+     * Pixels are Cairo ARGB32 (BGRA in memory on little-endian, premultiplied).
+     * Images larger than a slot are clipped; smaller ones leave the rest of
+     * the slot transparent, matching how the composed layer draws them.
+     * @param tile_id Tile ID (1-255)
+     * @param pixels ARGB32 pixel data
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param stride Bytes per image row
+     */
+    void upload_tile(int tile_id, const unsigned char* pixels, int width, int height, int stride);
+
+    /**
+     * Mark a slot empty (the tile is skipped when batches are built)
+     * @param tile_id Tile ID (1-255)
+     */
+    void clear_tile(int tile_id);
+
+    /**
+     * Check whether a tile ID has an image in the atlas
+     */
+    bool has_tile(int tile_id) const {
+        return tile_id > 0 && tile_id < MAX_TILES && loaded_[tile_id];
+    }
+
+    /**
+     * Get the atlas texture coordinates of a tile slot
+     */
+    void get_tile_texcoords(int tile_id, float& u0, float& v0, float& u1, float& v1) const;
+
+private:
+    GLuint texture_;
+    bool loaded_[MAX_TILES];
+};
+
+/**
+ * TileBatch is the quad list for one tile layer's visible window.
+ *
+ * The batch is rebuilt only when the map is edited or the window moves to
+ * a different first tile; sub-tile scrolling is a translation at draw time.
+ * The whole window is drawn from the atlas with a single glDrawArrays call.
+ */
+class TileBatch {
+public:
+    TileBatch();
+
+    /**
+     * Rebuild the quad list for a window of a tile map
+     * Cell IDs are remapped through the palette to atlas slots; flip and
+     * rotate flags permute the quad's texture coordinates. Cells outside the
+     * map, ID 0 and slots without an atlas image are skipped.
+     * @param atlas Atlas providing texture coordinates
+     * @param map World map to read
+     * @param palette 256 entries mapping tile IDs to atlas slots
+     * @param first_x Map column of the window's left edge
+     * @param first_y Map row of the window's top edge
+     * @param columns Window width in tiles
+     * @param rows Window height in tiles
+     */
+    void build(const TileAtlas& atlas, const TileMap& map, const uint8_t* palette,
+               int first_x, int first_y, int columns, int rows);
+
+    /**
+     * Rebuild the quads from the cells read by the last build()
+     * Used when the palette changes; the map is not read again.
+     * @param atlas Atlas providing texture coordinates
+     * @param palette 256 entries mapping tile IDs to atlas slots
+     */
+    void refresh(const TileAtlas& atlas, const uint8_t* palette);
+
+    /**
+     * Draw the batch (caller sets projection and blending)
+     * @param atlas Atlas texture to sample
+     * @param offset_x Screen X of the window's left edge
+     * @param offset_y Screen Y of the window's top edge
+     */
+    void draw(const TileAtlas& atlas, float offset_x, float offset_y) const;
+
+    /**
+     * Force the next is_current() check to fail
+     */
+    void invalidate() { valid_ = false; }
+
+    /**
+     * Check whether the batch was built for this window origin
+     */
+    bool is_current(int first_x, int first_y) const {
+        return valid_ && first_x == first_x_ && first_y == first_y_;
+    }
+
+    int get_quad_count() const { return (int)(vertices_.size() / FLOATS_PER_QUAD); }
+
+private:
+    static const int FLOATS_PER_VERTEX = 4;  // x, y, u, v
+    static const int FLOATS_PER_QUAD = FLOATS_PER_VERTEX * 4;
+
+    std::vector<float> vertices_;
+    std::vector<uint16_t> cells_;  // Window read from the map during build
+    int first_x_;
+    int first_y_;
+    bool valid_;
+    int columns_;
+    int rows_;
+
+    void build_quads(const TileAtlas& atlas, const uint8_t* palette);
+};
+
+} // namespace AbstractRuntime
+
+#endif // TILE_RENDERER_H
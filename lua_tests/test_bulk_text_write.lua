@@ -0,0 +1,80 @@
+-- Bulk Text Write Test
+-- Compares filling the screen cell by cell against the batched
+-- write_text_block / write_text_cells APIs, which take the text lock once
+
+print("=== Bulk Text Write Test ===")
+print("Testing batched text writes")
+
+console_section("Bulk Text Write Test")
+console_info("Filling the text grid with single calls and with batched writes")
+
+local cols, rows = get_text_grid_size()
+local total = cols * rows
+console_info("Text grid: " .. cols .. " x " .. rows .. " (" .. total .. " cells)")
+
+local white = pack_rgba(255, 255, 255)
+local blue = pack_rgba(0, 0, 160)
+
+-- Test 1: Baseline, one print_at per cell
+print("Test 1: print_at per cell")
+console_info("Test 1: print_at per cell")
+
+clear_text()
+local start_time = os.clock()
+for row = 0, rows - 1 do
+    for col = 0, cols - 1 do
+        print_at(col, row, "X")
+    end
+end
+local single_time = os.clock() - start_time
+wait_for_render_complete()
+console_info("print_at fill: " .. string.format("%.4f", single_time) .. " seconds")
+
+-- Test 2: One write_text_block call for the whole screen
+print("Test 2: write_text_block")
+console_info("Test 2: write_text_block with a string buffer")
+
+clear_text()
+local line = string.rep("B", cols)
+local buffer = string.rep(line, rows)
+
+start_time = os.clock()
+write_text_block(0, 0, cols, rows, buffer, white, blue)
+local block_time = os.clock() - start_time
+wait_for_render_complete()
+console_info("write_text_block fill: " .. string.format("%.4f", block_time) .. " seconds")
+
+-- Test 3: Scattered cells from a table
+print("Test 3: write_text_cells")
+console_info("Test 3: write_text_cells with a table of cells")
+
+local cells = {}
+for row = 0, rows - 1 do
+    for col = 0, cols - 1, 2 do
+        cells[#cells + 1] = { col, row, "C", white }
+    end
+end
+
+start_time = os.clock()
+local written = write_text_cells(cells)
+local cells_time = os.clock() - start_time
+wait_for_render_complete()
+console_info("write_text_cells: " .. written .. " cells in " ..
+             string.format("%.4f", cells_time) .. " seconds")
+assert_true(written == #cells, "Every in-range cell should be written")
+
+-- Test 4: Out of range cells are skipped
+print("Test 4: Clipping")
+console_info("Test 4: Cells outside the grid are ignored")
+
+written = write_text_cells({ { -1, 0, "Z" }, { cols, 0, "Z" }, { 0, rows, "Z" }, { 0, 0, "Z" } })
+assert_true(written == 1, "Only the in-range cell should be written")
+write_text_block(cols - 2, rows - 2, 4, 4, "QQQQQQQQQQQQQQQQ")
+
+if single_time > 0 and block_time > 0 then
+    console_info("Batched speedup: " .. string.format("%.1fx", single_time / block_time))
+end
+
+clear_text()
+console_info("Bulk text write test complete")
+print("=== Bulk Text Write Test Complete ===")
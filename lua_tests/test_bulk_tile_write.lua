@@ -0,0 +1,105 @@
+-- Bulk Tile Write Test
+-- Compares filling a map region cell by cell against the batched
+-- write_tiles / read_tiles / copy_tiles / move_tiles APIs
+
+print("=== Bulk Tile Write Test ===")
+print("Testing batched tile region edits")
+
+console_section("Bulk Tile Write Test")
+console_info("Writing, reading and copying tile map regions")
+
+-- The default map only covers the view; ignored if tiles are already set up
+set_world_map_size(256, 256)
+assert_true(init_tiles(), "init_tiles should succeed")
+
+local width, height = 64, 32
+local total = width * height
+console_info("Region: " .. width .. " x " .. height .. " (" .. total .. " cells)")
+
+-- Test 1: Baseline, one set_tile per cell
+print("Test 1: set_tile per cell")
+console_info("Test 1: set_tile per cell")
+
+local start_time = os.clock()
+for y = 0, height - 1 do
+    for x = 0, width - 1 do
+        set_tile(x, y, 1)
+    end
+end
+local single_time = os.clock() - start_time
+console_info("set_tile fill: " .. string.format("%.4f", single_time) .. " seconds")
+
+-- Test 2: One write_tiles call from a flat table
+print("Test 2: write_tiles from a table")
+console_info("Test 2: write_tiles with a table of cells")
+
+local cells = {}
+for i = 1, total do
+    cells[i] = (i % 7) + 1
+end
+
+start_time = os.clock()
+write_tiles(0, 0, width, height, cells)
+local block_time = os.clock() - start_time
+console_info("write_tiles fill: " .. string.format("%.4f", block_time) .. " seconds")
+
+local read = read_tiles(0, 0, width, height)
+assert_true(#read == total, "read_tiles should return width * height cells")
+local matches = true
+for i = 1, total do
+    if read[i] ~= cells[i] then matches = false break end
+end
+assert_true(matches, "Cells read back should match the cells written")
+
+-- Test 3: String buffers (one ID per byte, and 16-bit little-endian cells)
+print("Test 3: write_tiles from strings")
+console_info("Test 3: write_tiles with byte and 16-bit string buffers")
+
+write_tiles(0, 0, 4, 1, string.char(5, 6, 7, 8))
+read = read_tiles(0, 0, 4, 1)
+assert_true(read[1] == 5 and read[4] == 8, "Byte strings should hold one tile ID per cell")
+
+write_tiles(0, 0, 2, 1, string.char(3, 1, 4, 0))   -- Tile 3 flipped in X, tile 4
+read = read_tiles(0, 0, 2, 1)
+assert_true(read[1] == 0x103 and read[2] == 4, "16-bit strings should keep flag bits")
+
+local saved = read_tiles(0, 0, width, height, TILE_LAYER_FRONT, true)
+assert_true(#saved == total * 2, "String reads should hold two bytes per cell")
+write_tiles(0, 0, width, height, saved)
+read = read_tiles(0, 0, 2, 1)
+assert_true(read[1] == 0x103, "A string read should round-trip through write_tiles")
+
+-- Test 4: Overlapping copy and move
+print("Test 4: copy_tiles and move_tiles")
+console_info("Test 4: Overlapping copies keep the source pattern")
+
+write_tiles(0, 0, 4, 1, { 1, 2, 3, 4 })
+copy_tiles(0, 0, 4, 1, 1, 0)
+read = read_tiles(0, 0, 5, 1)
+assert_true(read[1] == 1 and read[2] == 1 and read[3] == 2 and read[5] == 4,
+            "Overlapping copy should behave as if the source was read first")
+
+move_tiles(0, 0, 2, 1, 1, 0)
+read = read_tiles(0, 0, 3, 1)
+assert_true(read[1] == 0 and read[2] == 1 and read[3] == 1,
+            "Move should clear source cells not overwritten")
+
+-- Test 5: Batched edits land together
+print("Test 5: Batched region edits")
+console_info("Test 5: begin_tile_edits / commit_tile_edits")
+
+begin_tile_edits()
+write_tiles(0, 0, 2, 1, { 9, 9 })
+copy_tiles(0, 0, 2, 1, 10, 0)
+assert_true(get_tile(0, 0) ~= 9, "Staged edits should not be visible before commit")
+commit_tile_edits()
+assert_true(get_tile(11, 0) == 9, "Staged copy should see the staged write")
+
+wait_for_render_complete()
+
+if single_time > 0 and block_time > 0 then
+    console_info("Batched speedup: " .. string.format("%.1fx", single_time / block_time))
+end
+
+console_info("Bulk tile write test complete")
+print("=== Bulk Tile Write Test Complete ===")
@@ -0,0 +1,58 @@
+-- Glyph Cache Test
+-- Verifies that repeated text redraws hit the glyph cache instead of
+-- rasterising through FreeType every frame
+
+print("=== Glyph Cache Test ===")
+print("Testing glyph cache hit/miss counters")
+
+console_section("Glyph Cache Test")
+console_info("Checking that redrawn glyphs are served from the cache")
+
+-- The glyph cache feeds the CPU raster path; force it for this test
+local gpu_was_enabled = is_text_gpu_rendering()
+set_text_gpu_rendering(false)
+
+-- Test 1: Stats table shape
+print("Test 1: Stats table")
+console_info("Test 1: get_glyph_cache_stats() returns counters")
+
+local stats = get_glyph_cache_stats()
+assert_true(type(stats) == "table", "Stats should be a table")
+assert_true(stats.hits ~= nil, "Stats should contain hits")
+assert_true(stats.misses ~= nil, "Stats should contain misses")
+assert_true(stats.cached_glyphs ~= nil, "Stats should contain cached_glyphs")
+
+-- Test 2: First draw of a character set fills the cache
+print("Test 2: Warm the cache")
+console_info("Test 2: Drawing a character set once")
+
+clear_text()
+print_at(0, 0, "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789")
+wait_for_render_complete()
+
+local warm = get_glyph_cache_stats()
+console_info("After warm-up: hits=" .. warm.hits .. " misses=" .. warm.misses ..
+             " cached=" .. warm.cached_glyphs)
+assert_true(warm.cached_glyphs > 0, "Cache should contain glyphs after first draw")
+
+-- Test 3: Redrawing the same characters only produces hits
+print("Test 3: Redraw from cache")
+console_info("Test 3: Redrawing the same characters many times")
+
+reset_glyph_cache_stats()
+for frame = 1, 10 do
+    for row = 1, 10 do
+        print_at(0, row, "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789")
+    end
+    wait_for_render_complete()
+end
+
+local redraw = get_glyph_cache_stats()
+console_info("After redraw: hits=" .. redraw.hits .. " misses=" .. redraw.misses)
+assert_true(redraw.hits > 0, "Redraws should hit the cache")
+assert_true(redraw.misses == 0, "Redrawing known glyphs should not rasterise again")
+
+clear_text()
+set_text_gpu_rendering(gpu_was_enabled)
+console_info("Glyph cache test complete")
+print("=== Glyph Cache Test Complete ===")
@@ -0,0 +1,118 @@
+-- Sprite Update Many Test
+-- Compares updating sprites with the per-sprite calls against one
+-- batched sprite_update_many call per frame
+
+print("=== Sprite Update Many Test ===")
+print("Testing batched sprite transform updates")
+
+console_section("Sprite Update Many Test")
+console_info("Updating many sprites with one call")
+
+-- The sprite bank exists only after init_sprites; loads are queued and
+-- finish on the render thread
+assert_true(init_sprites(), "init_sprites should succeed")
+assert_true(load_sprite(0, "../assets/sprite001.png"), "load_sprite should queue the image")
+wait_for_render_complete()
+wait_for_render_complete()
+
+local count = 2000
+local frames = 30
+console_info("Sprites: " .. count .. ", frames: " .. frames)
+
+local ids = {}
+for i = 1, count do
+    ids[i] = sprite_create(0, (i * 7) % 800, (i * 13) % 600)
+end
+assert_true(ids[1] ~= nil and ids[count] ~= nil, "sprite_create should return an ID for every sprite")
+
+-- Test 1: Baseline, the per-sprite calls for each sprite every frame,
+-- grouped so each frame's calls are drawn together
+print("Test 1: Per-sprite calls")
+console_info("Test 1: sprite_move / sprite_rotate / sprite_scale / sprite_alpha")
+
+local start_time = os.clock()
+for frame = 1, frames do
+    begin_sprite_updates()
+    for i = 1, count do
+        local id = ids[i]
+        sprite_move(id, (i + frame) % 800, (i * 3 + frame) % 600)
+        sprite_rotate(id, frame * 6)
+        sprite_scale(id, 1.0)
+        sprite_alpha(id, 1.0)
+    end
+    commit_sprite_updates()
+    wait_for_render_complete()
+end
+local single_time = os.clock() - start_time
+console_info("Per-sprite updates: " .. string.format("%.4f", single_time) .. " seconds")
+
+-- Per-call writes inside a batch are published together: nothing reaches
+-- the renderer while the batch is open, and the commit publishes once
+wait_for_render_complete()
+local published = get_sprite_publish_count()
+begin_sprite_updates()
+for i = 1, count do
+    sprite_move(ids[i], i % 800, (i * 5) % 600)
+end
+wait_for_render_complete()
+assert_true(get_sprite_publish_count() == published, "An open batch should not be published")
+commit_sprite_updates()
+assert_true(get_sprite_publish_count() == published + 1, "Committing should publish the batch once")
+
+-- Test 2: One flat table per frame (id, x, y, rotation, scale, alpha)
+print("Test 2: sprite_update_many from a table")
+console_info("Test 2: One batched update per frame")
+
+local batch = {}
+start_time = os.clock()
+for frame = 1, frames do
+    local n = 0
+    for i = 1, count do
+        batch[n + 1] = ids[i]
+        batch[n + 2] = (i + frame) % 800
+        batch[n + 3] = (i * 3 + frame) % 600
+        batch[n + 4] = frame * 6
+        batch[n + 5] = 1.0
+        batch[n + 6] = 1.0
+        n = n + 6
+    end
+    local updated = sprite_update_many(batch)
+    assert_true(updated == count, "Every visible sprite should be updated")
+    wait_for_render_complete()
+end
+local batch_time = os.clock() - start_time
+console_info("Batched updates: " .. string.format("%.4f", batch_time) .. " seconds")
+
+-- Test 3: Hidden, destroyed and invalid entries are skipped
+print("Test 3: Skipped entries")
+console_info("Test 3: Destroyed sprites and bad values are skipped")
+
+sprite_destroy(ids[2])
+local updated = sprite_update_many({
+    ids[1], 10, 10, 0, 1.0, 1.0,
+    ids[2], 10, 10, 0, 1.0, 1.0,    -- Destroyed
+    ids[3], 10, 10, 0, 0.0, 1.0     -- Scale must be positive
+})
+assert_true(updated == 1, "Only the valid entry should be applied")
+
+-- Test 4: FFI array of SpriteTransform records through ffi.C
+print("Test 4: sprite_update_transforms through the FFI")
+console_info("Test 4: FFI SpriteTransform array")
+
+local ffi = require("ffi")
+local transforms = ffi.new("SpriteTransform[?]", 2)
+transforms[0].id = ids[4]; transforms[0].x = 100; transforms[0].y = 100; transforms[0].scale = 2; transforms[0].alpha = 0.5
+transforms[1].id = ids[5]; transforms[1].x = 200; transforms[1].y = 100; transforms[1].scale = 1; transforms[1].alpha = 1
+assert_true(ffi.C.sprite_update_transforms(transforms, 2) == 2, "FFI records should be applied")
+
+for i = 1, count do
+    sprite_destroy(ids[i])
+end
+wait_for_render_complete()
+
+if single_time > 0 and batch_time > 0 then
+    console_info("Batched speedup: " .. string.format("%.1fx", single_time / batch_time))
+end
+
+console_info("Sprite update many test complete")
+print("=== Sprite Update Many Test Complete ===")
@@ -0,0 +1,69 @@
+-- Text Scrollback Test
+-- Appends more lines than fit on screen, then pages back through the
+-- scrollback ring and returns to the live view
+
+print("=== Text Scrollback Test ===")
+print("Testing scrollback ring and viewport paging")
+
+console_section("Text Scrollback Test")
+console_info("Appending lines and paging through history")
+
+local cols, rows = get_text_grid_size()
+
+-- Test 1: Enable a bounded scrollback ring
+print("Test 1: Enable scrollback")
+console_info("Test 1: set_text_scrollback_size(200)")
+
+assert_true(set_text_scrollback_size(200), "Scrollback should be enabled")
+assert_true(get_text_scrollback_count() == 0, "New scrollback should be empty")
+
+-- Test 2: Lines scrolled off the top are kept
+print("Test 2: Append lines")
+console_info("Test 2: Appending " .. (rows + 50) .. " lines")
+
+clear_text()
+local start_time = os.clock()
+for i = 1, rows + 50 do
+    append_text_line("Log line " .. i)
+end
+local append_time = os.clock() - start_time
+wait_for_render_complete()
+
+console_info("Append time: " .. string.format("%.4f", append_time) .. " seconds")
+console_info("History lines: " .. get_text_scrollback_count())
+assert_true(get_text_scrollback_count() >= 50, "Scrolled-off lines should be in the scrollback")
+
+-- Test 3: Page back and forward
+print("Test 3: Paging")
+console_info("Test 3: Paging back one screen and returning")
+
+page_text_scrollback(1)
+wait_for_render_complete()
+assert_true(get_text_scrollback_view() == math.min(rows, get_text_scrollback_count()),
+            "View should move back one screen")
+
+set_text_scrollback_view(100000)
+assert_true(get_text_scrollback_view() == get_text_scrollback_count(),
+            "View should clamp to the oldest line")
+wait_for_render_complete()
+
+page_text_scrollback(-1000)
+assert_true(get_text_scrollback_view() == 0, "View should clamp to the live screen")
+wait_for_render_complete()
+
+-- Test 4: Memory stays bounded by the ring size
+print("Test 4: Ring bound")
+console_info("Test 4: Appending past the ring capacity")
+
+for i = 1, 400 do
+    append_text_line("Overflow line " .. i)
+end
+assert_true(get_text_scrollback_count() == 200, "Scrollback should stop at its capacity")
+
+clear_text_scrollback()
+assert_true(get_text_scrollback_count() == 0, "Scrollback should be empty after clearing")
+set_text_scrollback_size(0)
+
+clear_text()
+console_info("Text scrollback test complete")
+print("=== Text Scrollback Test Complete ===")
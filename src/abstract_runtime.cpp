@@ -2,8 +2,14 @@
 #include "sprite_bank.h"
 #include "sprite_renderer.h"
 #include "tile_layer.h"
+#include "seqlock.h"
 #include "input_system.h"
 #include "lua_bindings.h"
+#include "glyph_cache.h"
+#include "font_atlas.h"
+#include "text_renderer.h"
+#include "tile_renderer.h"
+#include "tile_map.h"
 
 
 #include <SDL2/SDL.h>
@@ -17,6 +23,9 @@
 #include <cmath>
 #include <cstdio>
 #include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <array>
 #include <mutex>
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -80,12 +89,73 @@ static std::atomic<int> g_bg_b{0};
 // Text system - 32-bit Unicode text buffer for proper PETSCII support
 // Thread safety: g_text_mutex protects all text buffer and color array access
 // - Background thread (app) calls print_at(), clear_text(), etc. with mutex
-// - Main thread (renderer) calls upload_text_to_texture() with mutex
+// - Main thread (renderer) holds the mutex only to publish dirty cells into
+//   g_text_front, then rasterises from that snapshot without the lock
 // - Color setting functions (set_text_ink/paper) are atomic writes, no mutex needed
-static uint32_t g_text_buffer[25][80]; // 25 rows, 80 Unicode codepoints
+// - Storage is structure-of-arrays, row-major: cell (col, row) is at text_index(col, row)
+//   and is sized at init from the screen mode's grid dimensions
+static std::vector<uint32_t> g_text_buffer; // Unicode codepoints
 static int g_text_columns = 80;
 static int g_text_rows = 25;
 
+// Text cell geometry (pixels) shared by rasterisation and dirty-rect upload
+// Set per screen mode from TEXT_MODE_LAYOUTS
+static int g_text_cell_width = 16;   // 16 pixels per character
+static int g_text_cell_height = 24;  // 24 pixels per line for better spacing
+static int g_text_origin_x = 15;     // Left margin of the text grid
+static int g_text_origin_y = 50;     // Top margin of the text grid
+static int g_text_baseline = 14;     // Baseline offset from top of cell
+static int g_text_font_size = 16;    // FreeType pixel size
+
+// Optional grid size override requested before init (0 = use screen mode)
+static int g_text_columns_override = 0;
+static int g_text_rows_override = 0;
+
+// Text grid layout for each screen mode
+struct TextModeLayout {
+    int columns;
+    int rows;
+    int cell_width;
+    int cell_height;
+    int font_size;
+    int baseline;
+    int extra_width;  // Additional window width beyond grid and margins
+};
+
+static const TextModeLayout TEXT_MODE_LAYOUTS[] = {
+    { 20, 25, 16, 24, 16, 14,  0},  // SCREEN_20_COLUMN
+    { 40, 25, 16, 24, 16, 14,  0},  // SCREEN_40_COLUMN
+    { 80, 25, 16, 24, 16, 14, 32},  // SCREEN_80_COLUMN
+    {132, 50,  8, 12,  8,  7,  0},  // SCREEN_132_COLUMN
+    {200, 60,  8, 12,  8,  7,  0},  // SCREEN_200_COLUMN
+};
+
+// Ring-buffer row mapping: logical row r is stored in physical row
+// (r + g_text_first_row) % g_text_rows, so scrolling by a line only moves
+// this index and clears one row. Protected by g_text_mutex.
+static int g_text_first_row = 0;
+
+// Fine scroll offset in pixels applied to the whole grid at render time
+// (scroll_text); whole rows are handed to the ring. Protected by g_text_mutex.
+static int g_text_scroll_x = 0;
+static int g_text_scroll_y = 0;
+
+// Physical storage row of logical row (row must be in range)
+static inline int text_physical_row(int row) {
+    int physical = row + g_text_first_row;
+    return physical >= g_text_rows ? physical - g_text_rows : physical;
+}
+
+// Index of physical cell (col, physical_row) in the text storage arrays
+static inline size_t text_physical_index(int col, int physical_row) {
+    return (size_t)physical_row * g_text_columns + col;
+}
+
+// Index of logical cell (col, row) in the text storage arrays
+static inline size_t text_index(int col, int row) {
+    return text_physical_index(col, text_physical_row(row));
+}
+
 // =============================================================================
 // CURSOR SYSTEM
 // =============================================================================
@@ -116,14 +186,16 @@ static std::mutex g_text_mutex; // Protects text buffer and color arrays
 static std::mutex g_graphics_mutex; // Protects graphics operations
 
 // Text color maps - foreground (ink) and background (paper) colors
-static uint32_t g_text_ink_colors[25][80];   // RGBA colors for text foreground
-static uint32_t g_text_paper_colors[25][80]; // RGBA colors for text background
+static std::vector<uint32_t> g_text_ink_colors;   // RGBA colors for text foreground
+static std::vector<uint32_t> g_text_paper_colors; // RGBA colors for text background
 
 // Text backup system - expanding array of saved screens
 struct TextBackup {
-    uint32_t text_buffer[25][80];
-    uint32_t ink_colors[25][80];
-    uint32_t paper_colors[25][80];
+    int columns = 0;
+    int rows = 0;
+    std::vector<uint32_t> text_buffer;
+    std::vector<uint32_t> ink_colors;
+    std::vector<uint32_t> paper_colors;
 };
 
 static std::vector<TextBackup> g_text_backups;
@@ -142,68 +214,224 @@ static uint32_t g_current_paper_color = 0x00000000; // Default: fully transparen
 // Text system using FreeType
 static FT_Library g_ft_library = nullptr;
 static FT_Face g_ft_face = nullptr;
+static AbstractRuntime::GlyphCache g_glyph_cache;  // Rasterised glyphs, render thread only
 static unsigned char* g_text_bitmap = nullptr;
 static GLuint g_text_texture = 0;
 static bool g_text_dirty = true;  // Mark text as needing upload
 
+// Text dirty tracking - one column span per physical row plus a whole-layer flag
+// Note: All dirty state is protected by g_text_mutex
+struct TextDirtySpan {
+    int min_col;  // First dirty column (max_col < min_col means the row is clean)
+    int max_col;  // Last dirty column
+};
+static std::vector<TextDirtySpan> g_text_dirty_spans;  // One entry per row
+static bool g_text_dirty_all = true;           // Every cell needs re-rasterising
+static bool g_text_texture_allocated = false;  // Text texture storage exists
+
+// GPU text path - grid drawn from the font atlas in one batched draw call
+// g_text_gpu_requested is protected by g_text_mutex; the rest is render thread only
+static bool g_text_gpu_requested = true;   // Use the GPU path when available
+static bool g_text_gpu_active = false;     // Path used for the current frame
+static TextCursor g_cursor_snapshot;       // Cursor state captured with the text
+
+// Render-side front copy of the text grid (render thread only)
+// Arrays and dirty spans use physical rows, like the back buffer.
+// Writers only touch the back arrays above. Once per frame the renderer takes
+// g_text_mutex, copies the dirty cells across and takes over the dirty
+// spans, then rasterises from this snapshot after releasing the lock, so
+// writer latency does not depend on how long a frame takes to draw.
+struct TextFrontBuffer {
+    std::vector<uint32_t> text_buffer;
+    std::vector<uint32_t> ink_colors;
+    std::vector<uint32_t> paper_colors;
+    std::vector<TextDirtySpan> dirty_spans;  // Spans published but not yet drawn
+    int first_row = 0;                       // Ring offset at publish time
+    int scroll_x = 0;                        // Fine pixel scroll at publish time
+    int scroll_y = 0;
+    bool dirty_all = false;
+    bool dirty = false;
+};
+static TextFrontBuffer g_text_front;
+
+// Text scrollback - rows that scrolled off the top of the grid
+// A bounded ring with the same cell layout as g_text_buffer; history line h
+// (0 = oldest) is stored in row (head + h) % capacity. Paging the view back
+// composes history and live rows into the front buffer at publish time.
+// Note: Protected by g_text_mutex
+struct TextScrollback {
+    int capacity = 0;  // Maximum rows kept (0 = disabled)
+    int count = 0;     // Rows currently stored
+    int head = 0;      // Storage row of the oldest line
+    int view = 0;      // Rows the visible window is paged back (0 = live)
+    std::vector<uint32_t> text_buffer;
+    std::vector<uint32_t> ink_colors;
+    std::vector<uint32_t> paper_colors;
+};
+static TextScrollback g_text_scrollback;
+
 // Cairo graphics layer (renders under text)
 static cairo_surface_t* g_graphics_surface = nullptr;
 static cairo_t* g_graphics_cr = nullptr;
 static unsigned char* g_graphics_bitmap = nullptr;
 static GLuint g_graphics_texture = 0;
 static bool g_graphics_dirty = true;  // Mark graphics as needing upload
+static bool g_graphics_texture_allocated = false;  // Graphics texture storage exists
 
 // Sprite system (renders between background and graphics)
 AbstractRuntime::SpriteBank* g_sprite_bank = nullptr;
 static AbstractRuntime::SpriteRenderer* g_sprite_renderer = nullptr;
 static bool g_sprites_initialized = false;
 
-// Front tile system (renders in front, original API)
-static cairo_surface_t* g_tile_surface = nullptr;
-static cairo_t* g_tile_cr = nullptr;
-static unsigned char* g_tile_bitmap = nullptr;
-static GLuint g_tile_texture = 0;
-static bool g_tile_dirty = true;  // Mark tiles for upload
+// Tile system (renders behind graphics, layers are defined further down)
 static bool g_tiles_initialized = false;
 
-// Front tile world map (large, application-defined)
-static int g_world_map_width = 0;
-static int g_world_map_height = 0;
-static int* g_world_map = nullptr;  // Large 2D world map stored as 1D
-
-// Back tile system (renders behind front layer for parallax)
-static cairo_surface_t* g_back_tile_surface = nullptr;
-static cairo_t* g_back_tile_cr = nullptr;
-static unsigned char* g_back_tile_bitmap = nullptr;
-static GLuint g_back_tile_texture = 0;
-static bool g_back_tile_dirty = true;  // Mark back tiles for upload
-
-// Back tile world map (independent from front layer)
-static int g_back_world_map_width = 0;
-static int g_back_world_map_height = 0;
-static int* g_back_world_map = nullptr;  // Back layer 2D world map
-
-// Tile viewport (shared between both layers)
+// Tile viewport window (shared by all layers)
 static int g_tile_grid_width = 0;   // Viewport width in tiles
 static int g_tile_grid_height = 0;  // Viewport height in tiles
-static float g_viewport_x = 0.0f;   // Front layer viewport position in world (pixels)
-static float g_viewport_y = 0.0f;   // Front layer viewport position in world (pixels)
-
-// Back layer viewport (independent scrolling for parallax)
-static float g_back_viewport_x = 0.0f;   // Back layer viewport position in world (pixels)
-static float g_back_viewport_y = 0.0f;   // Back layer viewport position in world (pixels)
 
 static cairo_surface_t* g_tile_surfaces[256] = {nullptr};  // Loaded tile surfaces (shared)
 
+// Tile palette - map cells hold tile IDs that are remapped to loaded tile
+// images here, so a map can be re-skinned without touching its cells
+static std::array<uint8_t, 256> identity_tile_palette() {
+    std::array<uint8_t, 256> palette;
+    for (int i = 0; i < 256; i++) palette[i] = (uint8_t)i;
+    return palette;
+}
+static std::array<uint8_t, 256> g_tile_palette = identity_tile_palette();
+
+// Tile animations - an animated tile ID cycles through tile images by
+// overriding its palette entry, so animated cells never touch the map
+struct TileAnimation {
+    std::vector<uint8_t> frames;      // Tile image per frame (empty = not animated)
+    std::vector<uint32_t> frame_end;  // Cumulative frame end times (ms)
+    uint64_t start_ms = 0;            // Clock time the animation was defined
+};
+static std::mutex g_tile_animation_mutex;  // Protects g_tile_palette and g_tile_animations
+static std::array<TileAnimation, 256> g_tile_animations;
+static int g_tile_animation_count = 0;
+
+// Palette resolved for the current frame (render thread only)
+static std::array<uint8_t, 256> g_tile_draw_palette = identity_tile_palette();
+
+static_assert(TILE_ID_MASK == AbstractRuntime::TileMap::ID_MASK &&
+              TILE_FLIP_X == AbstractRuntime::TileMap::FLIP_X &&
+              TILE_FLIP_Y == AbstractRuntime::TileMap::FLIP_Y &&
+              TILE_ROTATE == AbstractRuntime::TileMap::ROTATE &&
+              TILE_SOLID == AbstractRuntime::TileMap::SOLID,
+              "public tile cell flags must match the map storage");
+
 // Tile view dimensions (screen + border, shared)
 static int g_tile_view_width = 0;   // screen_width + 768
 static int g_tile_view_height = 0;  // screen_height + 768
 
-// Tile scrolling offset (in pixels)
-static float g_tile_scroll_x = 0.0f;      // Front layer scroll
-static float g_tile_scroll_y = 0.0f;      // Front layer scroll
-static float g_back_tile_scroll_x = 0.0f; // Back layer scroll
-static float g_back_tile_scroll_y = 0.0f; // Back layer scroll
+// Composed tile views are toroidal rings of grid_width x grid_height cells.
+// World tile (x, y) always lives in cell (x mod grid_width, y mod grid_height),
+// so a viewport shift only composes the newly exposed strips and the render
+// wraps texture coordinates across the seam.
+struct TileViewRing {
+    int start_x = 0;     // World tile at the left edge of the composed window
+    int start_y = 0;     // World tile at the top edge of the composed window
+    bool valid = false;  // Ring holds the window at start_x, start_y
+};
+
+// World map chunk residency - with a backing file set, chunks further than
+// this many chunks from the viewport centre are evicted when the view shifts
+static int g_world_chunk_radius = 8;
+
+// Map edits made since the last frame, as world tile coordinates
+// set_tile() records the cell instead of dirtying the whole layer; the render
+// thread coalesces the list and redraws only edited cells inside the window.
+// Too many edits in one frame fall back to recomposing the whole view.
+typedef std::pair<int, int> TileEdit;
+struct TileEditList {
+    std::vector<TileEdit> cells;
+    bool overflow = false;  // Recompose the whole view instead
+};
+static const size_t MAX_TILE_EDITS_PER_FRAME = 256;
+static std::mutex g_tile_edit_mutex;  // Protects every layer's edit list
+
+// Edit batches - between begin_tile_edits() and commit_tile_edits() a thread's
+// map edits and scroll changes are staged, then applied together between
+// frames, so the renderer never draws half of a batch.
+struct StagedTileEdit {
+    enum Kind { SET, FILL, CLEAR, WRITE, COPY, MOVE };
+    Kind kind;
+    int layer;
+    int x, y;                     // Target (copy destination)
+    int width, height;
+    int cell;                     // SET and FILL value
+    int src_x, src_y;             // COPY and MOVE source
+    std::vector<uint16_t> cells;  // WRITE data, width * height cells
+
+    StagedTileEdit(Kind kind, int layer, int x = 0, int y = 0, int width = 0, int height = 0, int cell = 0)
+        : kind(kind), layer(layer), x(x), y(y), width(width), height(height), cell(cell)
+        , src_x(0), src_y(0) {}
+};
+static thread_local std::vector<StagedTileEdit> t_staged_tile_edits;
+static thread_local int t_tile_edit_depth = 0;              // Nested begin_tile_edits() calls
+static thread_local uint32_t t_tile_views_pending = 0;      // Layers with unpublished views
+
+// Held by the render thread while it reads tile state for a frame and by
+// batch commits, so a commit lands entirely before or after a frame
+static std::mutex g_tile_frame_mutex;
+
+// GPU tile path - each layer's visible window is one quad batch drawn from a
+// shared tile atlas, so scrolling and edits need no Cairo composition.
+// Atlas and batches are render thread only; load_tile() flags slots pending.
+static AbstractRuntime::TileAtlas g_tile_atlas;
+static std::atomic<bool> g_tile_gpu_requested(true);  // Use the GPU path when available
+static bool g_tile_gpu_active = false;                // Path used for the current frame
+static std::atomic<bool> g_tile_atlas_pending[256];   // Tile image changed since last sync
+
+// Tile layers - each has its own world map, viewport, parallax factor and
+// visibility, and all of them go through the same update and draw code.
+// Layers are drawn in index order (TILE_LAYER_BACK first, TILE_LAYER_FRONT
+// next, further layers in front). On the GPU path a layer costs one batched
+// draw; its Cairo surface and texture are only created if the Cairo path is
+// used.
+//
+// Scroll state is owned by the app side under g_tile_view_mutex and published
+// to the render thread through a seqlock, so a frame always sees viewport,
+// scroll offset and window start from the same update.
+struct TileViewState {
+    float viewport_x = 0.0f;  // Viewport position in world (pixels)
+    float viewport_y = 0.0f;
+    float scroll_x = 0.0f;    // Offset of the viewport within the composed window
+    float scroll_y = 0.0f;
+    int window_x = 0;         // World tile at the composed window's left edge
+    int window_y = 0;         // World tile at the composed window's top edge
+};
+
+struct TileLayerState {
+    AbstractRuntime::TileMap map;  // Sparse chunked world map
+    int map_width = 0;             // World map size in tiles (0 = not set)
+    int map_height = 0;
+
+    TileViewState view;            // Current scroll state (g_tile_view_mutex)
+    float parallax_x = 1.0f;       // Fraction of camera movement (g_tile_view_mutex)
+    float parallax_y = 1.0f;
+    AbstractRuntime::SeqLock<TileViewState> published_view;  // Read by the renderer
+
+    std::atomic<bool> visible{true};
+    std::atomic<bool> dirty{true};  // Rebuild the batch or composition
+    TileEditList edits;             // Cell edits since the last frame (g_tile_edit_mutex)
+
+    // Render thread only
+    TileViewState frame_view;               // Snapshot used by the current frame
+    AbstractRuntime::TileBatch batch;       // GPU path window
+    TileViewRing ring;                      // Cairo path composed window
+    cairo_surface_t* surface = nullptr;
+    cairo_t* cr = nullptr;
+    GLuint texture = 0;
+    bool texture_allocated = false;
+};
+static TileLayerState g_tile_layers[MAX_TILE_LAYERS];
+static std::atomic<int> g_tile_layer_count(2);  // Layers drawn (back and front by default)
+static std::mutex g_tile_view_mutex;  // Serialises scroll writers and view publishing
+static float g_tile_camera_x = 0.0f;  // Camera position for parallax scrolling (g_tile_view_mutex)
+static float g_tile_camera_y = 0.0f;
 
 // FPS tracking
 static std::chrono::high_resolution_clock::time_point g_last_frame_time;
@@ -220,6 +448,7 @@ using UserApplicationFunction = void(*)();
 
 static bool init_sdl_and_opengl(int screen_mode);
 static bool init_font_system();
+static bool init_gpu_text_renderer();
 static bool init_graphics_system();
 static bool init_sprite_system();
 static void main_thread_loop();
@@ -228,16 +457,21 @@ static void upload_text_to_texture();
 static void upload_graphics_to_texture();
 static void render_text_texture_to_screen();
 static void render_graphics_texture_to_screen();
-static void upload_tiles_to_texture();
-static void upload_back_tiles_to_texture();
-static void render_tiles_texture_to_screen();
-static void render_back_tiles_texture_to_screen();
+static void render_tile_layers();
+static void update_tile_layers();
+static void update_tile_layer_ring(TileLayerState& layer, const bool* palette_changed);
+static void update_tile_batch(TileLayerState& layer);
 static void render_sprites();
 static void render_fps_overlay();
 static void update_fps_stats();
 static void cleanup_all();
 static void clear_text_buffer();
 static void init_text_colors();
+static void mark_text_cell_dirty(int col, int row);
+static void mark_text_span_dirty(int row, int first_col, int last_col);
+static void mark_text_rect_dirty(int x, int y, int width, int height);
+static void mark_text_all_dirty();
+static void clear_text_dirty_state();
 static uint32_t pack_rgba(int r, int g, int b, int a);
 static void unpack_rgba(uint32_t color, int* r, int* g, int* b, int* a);
 
@@ -252,34 +486,52 @@ bool init_abstract_runtime(int screen_mode) {
 
     std::cout << "Initializing NewBCPL Abstract Runtime..." << std::endl;
 
-    // Set screen dimensions based on text columns (16px font + margins)
-    const int FONT_WIDTH = 16;
-    const int FONT_HEIGHT = 24;  // Better line spacing for readability
+    // Set screen dimensions from the mode's text grid (cell size + margins)
     const int MARGIN_X = 40;     // Side margins
     const int MARGIN_Y = 50;     // Top/bottom margins (matches text rendering)
-    const int TEXT_ROWS = 25;    // Standard terminal height
-    
-    switch (screen_mode) {
-        case SCREEN_20_COLUMN:
-            g_screen_width = (20 * FONT_WIDTH) + (2 * MARGIN_X);   // 320 + 80 = 400
-            g_screen_height = (TEXT_ROWS * FONT_HEIGHT) + (2 * MARGIN_Y); // 550 + 100 = 650
-            g_text_columns = 20;
-            break;
-        case SCREEN_40_COLUMN:
-            g_screen_width = (40 * FONT_WIDTH) + (2 * MARGIN_X);   // 560 + 80 = 640
-            g_screen_height = (TEXT_ROWS * FONT_HEIGHT) + (2 * MARGIN_Y); // 550 + 100 = 650
-            g_text_columns = 40;
-            break;
-        case SCREEN_80_COLUMN:
-            g_screen_width = (80 * FONT_WIDTH) + (2 * MARGIN_X) + 32;   // 1280 + 80 + 32 = 1392
-            g_screen_height = (TEXT_ROWS * FONT_HEIGHT) + (2 * MARGIN_Y); // 550 + 100 = 650
-            g_text_columns = 80;
-            break;
-        default:
-            g_screen_width = (40 * FONT_WIDTH) + (2 * MARGIN_X);   // Default to 40 column
-            g_screen_height = (TEXT_ROWS * FONT_HEIGHT) + (2 * MARGIN_Y); // 550 + 100 = 650
-            g_text_columns = 40;
-            break;
+    const int MAX_SCREEN_SIZE = 8192;  // Window and text bitmap limit per side
+    const int mode_count = sizeof(TEXT_MODE_LAYOUTS) / sizeof(TEXT_MODE_LAYOUTS[0]);
+    
+    // Unknown modes default to 40 column
+    const TextModeLayout& layout = (screen_mode >= 0 && screen_mode < mode_count)
+        ? TEXT_MODE_LAYOUTS[screen_mode] : TEXT_MODE_LAYOUTS[SCREEN_40_COLUMN];
+    
+    g_text_columns = g_text_columns_override > 0 ? g_text_columns_override : layout.columns;
+    g_text_rows = g_text_rows_override > 0 ? g_text_rows_override : layout.rows;
+    g_text_cell_width = layout.cell_width;
+    g_text_cell_height = layout.cell_height;
+    g_text_font_size = layout.font_size;
+    g_text_baseline = layout.baseline;
+    
+    // An overridden grid must still fit a window the text bitmap can cover
+    int max_columns = (MAX_SCREEN_SIZE - 2 * MARGIN_X - layout.extra_width) / g_text_cell_width;
+    int max_rows = (MAX_SCREEN_SIZE - 2 * MARGIN_Y) / g_text_cell_height;
+    if (g_text_columns > max_columns || g_text_rows > max_rows) {
+        g_text_columns = std::min(g_text_columns, max_columns);
+        g_text_rows = std::min(g_text_rows, max_rows);
+        std::cerr << "Text grid reduced to " << g_text_columns << "x" << g_text_rows
+                  << " to fit a " << MAX_SCREEN_SIZE << " pixel window" << std::endl;
+    }
+    
+    // Grid plus margins, e.g. 80 column: 1280 + 80 + 32 = 1392 x 600 + 100 = 700
+    g_screen_width = (g_text_columns * g_text_cell_width) + (2 * MARGIN_X) + layout.extra_width;
+    g_screen_height = (g_text_rows * g_text_cell_height) + (2 * MARGIN_Y);
+    
+    // Size text storage for the grid
+    size_t cell_count = (size_t)g_text_columns * g_text_rows;
+    g_text_buffer.assign(cell_count, 0x20);
+    g_text_ink_colors.assign(cell_count, 0xFFFFFFFF);
+    g_text_paper_colors.assign(cell_count, 0x00000000);
+    g_text_dirty_spans.assign(g_text_rows, TextDirtySpan{g_text_columns, -1});
+    g_text_front.text_buffer = g_text_buffer;
+    g_text_front.ink_colors = g_text_ink_colors;
+    g_text_front.paper_colors = g_text_paper_colors;
+    g_text_front.dirty_spans = g_text_dirty_spans;
+    if (g_text_scrollback.capacity > 0) {
+        size_t history_cells = (size_t)g_text_scrollback.capacity * g_text_columns;
+        g_text_scrollback.text_buffer.assign(history_cells, 0x20);
+        g_text_scrollback.ink_colors.assign(history_cells, 0xFFFFFFFF);
+        g_text_scrollback.paper_colors.assign(history_cells, 0x00000000);
     }
 
     // Initialize SDL and OpenGL
@@ -416,6 +668,26 @@ void* get_ft_face() {
     return g_ft_face;
 }
 
+void get_glyph_cache_stats(uint64_t* hits, uint64_t* misses, int* cached_glyphs) {
+    if (hits) *hits = g_glyph_cache.get_hits();
+    if (misses) *misses = g_glyph_cache.get_misses();
+    if (cached_glyphs) *cached_glyphs = (int)g_glyph_cache.get_cached_count();
+}
+
+void reset_glyph_cache_stats() {
+    g_glyph_cache.reset_stats();
+}
+
+void set_text_gpu_rendering(bool enable) {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    g_text_gpu_requested = enable;
+}
+
+bool is_text_gpu_rendering() {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    return g_text_gpu_requested && AbstractRuntime::get_text_renderer() != nullptr;
+}
+
 // =============================================================================
 // SDL AND OPENGL INITIALIZATION
 // =============================================================================
@@ -490,7 +762,8 @@ static bool init_font_system() {
     }
 
     // Set font size
-    FT_Set_Pixel_Sizes(g_ft_face, 0, 16);
+    FT_Set_Pixel_Sizes(g_ft_face, 0, g_text_font_size);
+    g_glyph_cache.set_face(g_ft_face);
 
     // Create text bitmap buffer (RGBA)
     g_text_bitmap = new unsigned char[g_screen_width * g_screen_height * 4];
@@ -500,6 +773,28 @@ static bool init_font_system() {
     glGenTextures(1, &g_text_texture);
 
     std::cout << "Font system initialized" << std::endl;
+
+    // GPU text path is optional; the CPU raster path above is the fallback
+    if (!init_gpu_text_renderer()) {
+        std::cout << "[Runtime] GPU text renderer unavailable, using CPU text raster" << std::endl;
+    }
+    return true;
+}
+
+static bool init_gpu_text_renderer() {
+    if (!AbstractRuntime::initialize_default_font_atlas(g_text_font_size)) {
+        return false;
+    }
+    if (!AbstractRuntime::initialize_text_renderer(AbstractRuntime::get_font_atlas())) {
+        AbstractRuntime::shutdown_font_atlas();
+        return false;
+    }
+
+    AbstractRuntime::get_text_renderer()->set_grid_layout(
+        g_text_columns, g_text_rows, g_text_origin_x, g_text_origin_y,
+        g_text_cell_width, g_text_cell_height, g_text_baseline);
+
+    std::cout << "[Runtime] GPU text renderer initialized" << std::endl;
     return true;
 }
 
@@ -533,12 +828,6 @@ static bool init_graphics_system() {
 
     // Create OpenGL texture for graphics
     glGenTextures(1, &g_graphics_texture);
-    
-    // Create OpenGL texture for tiles
-    glGenTextures(1, &g_tile_texture);
-    
-    // Create OpenGL texture for back tiles
-    glGenTextures(1, &g_back_tile_texture);
 
     // Set default line width
     cairo_set_line_width(g_graphics_cr, 1.0);
@@ -726,32 +1015,22 @@ static void render_frame() {
         g_graphics_dirty = false;
     }
     
-    if (g_tile_dirty) {
-        upload_tiles_to_texture();
-        g_tile_dirty = false;
-    }
-    
-    if (g_back_tile_dirty) {
-        upload_back_tiles_to_texture();
-        g_back_tile_dirty = false;
-    }
-    if (g_text_dirty) {
-        upload_text_to_texture();
-        g_text_dirty = false;
-    }
+    // Tiles rebuild their GPU batches or Cairo composition when dirty
+    update_tile_layers();
+
+    // Text tracks its own dirty cells and cursor blink under g_text_mutex
+    upload_text_to_texture();
     
     // Render layers in correct Z-order (back to front):
-    // 1. Back tiles (far background for parallax)
-    render_back_tiles_texture_to_screen();
-    // 2. Front tiles (main background terrain)  
-    render_tiles_texture_to_screen();
-    // 3. Graphics (Cairo vector graphics)
+    // 1. Tile layers (back layer, front layer, then any further layers)
+    render_tile_layers();
+    // 2. Graphics (Cairo vector graphics)
     render_graphics_texture_to_screen();
-    // 4. Sprites (should be under text)
+    // 3. Sprites (should be under text)
     render_sprites();
-    // 5. Text (should be on top of sprites) 
+    // 4. Text (should be on top of sprites) 
     render_text_texture_to_screen();
-    // 6. FPS overlay (on top of everything)
+    // 5. FPS overlay (on top of everything)
     render_fps_overlay();
 
     // Present frame
@@ -766,163 +1045,476 @@ static void render_frame() {
     g_frame_sync_cv.notify_all();
 }
 
-static void upload_tiles_to_texture() {
-    if (!g_tiles_initialized || !g_tile_cr) return;
-    
-    // Clear the tile surface
-    cairo_save(g_tile_cr);
-    cairo_set_operator(g_tile_cr, CAIRO_OPERATOR_CLEAR);
-    cairo_paint(g_tile_cr);
-    cairo_restore(g_tile_cr);
-    
-    // Calculate which portion of world map is visible
-    int world_start_x = (int)(g_viewport_x / 128.0f);
-    int world_start_y = (int)(g_viewport_y / 128.0f);
-    
-    // Draw tiles from world map to viewport texture
-    for (int grid_y = 0; grid_y < g_tile_grid_height; grid_y++) {
-        for (int grid_x = 0; grid_x < g_tile_grid_width; grid_x++) {
-            // Calculate world map coordinates
-            int world_x = world_start_x + grid_x;
-            int world_y = world_start_y + grid_y;
-            
-            int tile_id = 0;
-            if (world_x >= 0 && world_x < g_world_map_width && 
-                world_y >= 0 && world_y < g_world_map_height) {
-                tile_id = g_world_map[world_y * g_world_map_width + world_x];
+// Upload a Cairo ARGB32 surface into a texture with no conversion pass
+// ARGB32 is a native-endian 32-bit word, which GL_BGRA with
+// GL_UNSIGNED_INT_8_8_8_8_REV describes exactly on any byte order, so the
+// driver reads Cairo's memory directly. Storage is allocated on the first
+// upload; later uploads only replace the contents with glTexSubImage2D.
+static void upload_cairo_surface_to_texture(cairo_surface_t* surface, GLuint texture,
+                                            bool* allocated, GLint filter) {
+    if (!surface || !texture) return;
+
+    cairo_surface_flush(surface);
+    const unsigned char* data = cairo_image_surface_get_data(surface);
+    int width = cairo_image_surface_get_width(surface);
+    int height = cairo_image_surface_get_height(surface);
+    int stride = cairo_image_surface_get_stride(surface);
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    if (!*allocated) {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0,
+                     GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        *allocated = true;
+    }
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / 4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height,
+                    GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, data);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
+// Copy a sub-rectangle of a flushed Cairo surface into allocated texture storage
+static void upload_cairo_region_to_texture(cairo_surface_t* surface, GLuint texture,
+                                           int x, int y, int width, int height) {
+    const unsigned char* data = cairo_image_surface_get_data(surface);
+    int stride = cairo_image_surface_get_stride(surface);
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / 4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height,
+                    GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
+                    data + (size_t)y * stride + (size_t)x * 4);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
+// Copy tile images loaded since the last frame into the atlas
+static void sync_tile_atlas() {
+    bool changed = false;
+    for (int tile_id = 1; tile_id < AbstractRuntime::TileAtlas::MAX_TILES; tile_id++) {
+        if (!g_tile_atlas_pending[tile_id].exchange(false)) continue;
+
+        cairo_surface_t* surface = g_tile_surfaces[tile_id];
+        if (surface) {
+            cairo_surface_flush(surface);
+            g_tile_atlas.upload_tile(tile_id,
+                                     cairo_image_surface_get_data(surface),
+                                     cairo_image_surface_get_width(surface),
+                                     cairo_image_surface_get_height(surface),
+                                     cairo_image_surface_get_stride(surface));
+        } else {
+            g_tile_atlas.clear_tile(tile_id);
+        }
+        changed = true;
+    }
+
+    // Batches skip tiles without images, so they must be rebuilt
+    if (changed) {
+        for (TileLayerState& layer : g_tile_layers) {
+            layer.batch.invalidate();
+        }
+    }
+}
+
+// Resolve the palette drawn this frame: base palette plus the current frame
+// of each tile animation. Marks IDs whose image changed since last frame.
+static bool update_tile_draw_palette(bool* changed) {
+    std::array<uint8_t, 256> palette;
+
+    {
+        std::lock_guard<std::mutex> lock(g_tile_animation_mutex);
+        palette = g_tile_palette;
+        if (g_tile_animation_count > 0) {
+            uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+
+            for (int tile_id = 1; tile_id < 256; tile_id++) {
+                const TileAnimation& animation = g_tile_animations[tile_id];
+                if (animation.frames.empty()) continue;
+
+                // Position within the loop picks the frame
+                uint32_t cycle = animation.frame_end.back();
+                uint32_t t = (uint32_t)((now - animation.start_ms) % cycle);
+                size_t frame = std::upper_bound(animation.frame_end.begin(),
+                                                animation.frame_end.end(), t) - animation.frame_end.begin();
+                palette[tile_id] = animation.frames[std::min(frame, animation.frames.size() - 1)];
             }
-            
-            if (tile_id > 0 && tile_id < 256 && g_tile_surfaces[tile_id]) {
-                // Calculate position in tile view (128 pixel grid)
-                double dest_x = grid_x * 128.0;
-                double dest_y = grid_y * 128.0;
-                
-                // Draw tile to Cairo surface
-                cairo_set_source_surface(g_tile_cr, g_tile_surfaces[tile_id], dest_x, dest_y);
-                cairo_rectangle(g_tile_cr, dest_x, dest_y, 128, 128);
-                cairo_fill(g_tile_cr);
+        }
+    }
+
+    bool any = false;
+    for (int tile_id = 0; tile_id < 256; tile_id++) {
+        changed[tile_id] = palette[tile_id] != g_tile_draw_palette[tile_id];
+        any = any || changed[tile_id];
+    }
+    g_tile_draw_palette = palette;
+    return any;
+}
+
+// Pick the tile path for this frame and bring it up to date
+// Runs under g_tile_frame_mutex and works from one view snapshot per layer,
+// so committed edit batches and scroll updates are seen whole.
+static void update_tile_layers() {
+    if (!g_tiles_initialized) return;
+
+    std::lock_guard<std::mutex> frame_lock(g_tile_frame_mutex);
+
+    // The atlas is created lazily on the render thread; every tile loaded
+    // so far is queued for it
+    if (g_tile_gpu_requested && !g_tile_atlas.is_initialized()) {
+        if (g_tile_atlas.initialize()) {
+            for (int tile_id = 1; tile_id < AbstractRuntime::TileAtlas::MAX_TILES; tile_id++) {
+                if (g_tile_surfaces[tile_id]) g_tile_atlas_pending[tile_id] = true;
             }
+        } else {
+            std::cerr << "[Runtime] Tile atlas unavailable, using Cairo tile composition" << std::endl;
+            g_tile_gpu_requested = false;
         }
     }
-    
-    // Upload Cairo bitmap to OpenGL texture (same as graphics system)
-    glBindTexture(GL_TEXTURE_2D, g_tile_texture);
-    
-    // Convert CAIRO_FORMAT_ARGB32 to GL_RGBA
-    unsigned char* rgba_data = new unsigned char[g_tile_view_width * g_tile_view_height * 4];
-    for (int i = 0; i < g_tile_view_width * g_tile_view_height; i++) {
-        // Cairo ARGB32 is stored as BGRA in memory on little-endian
-        rgba_data[i * 4 + 0] = g_tile_bitmap[i * 4 + 2]; // R
-        rgba_data[i * 4 + 1] = g_tile_bitmap[i * 4 + 1]; // G
-        rgba_data[i * 4 + 2] = g_tile_bitmap[i * 4 + 0]; // B
-        rgba_data[i * 4 + 3] = g_tile_bitmap[i * 4 + 3]; // A
+
+    // Switching paths rebuilds every layer through the new one
+    bool use_gpu = g_tile_gpu_requested && g_tile_atlas.is_initialized();
+    if (use_gpu != g_tile_gpu_active) {
+        g_tile_gpu_active = use_gpu;
+        for (TileLayerState& layer : g_tile_layers) {
+            layer.dirty = true;
+        }
+    }
+
+    // Resolve this frame's palette; only IDs whose image changed are redrawn
+    bool palette_changed[256];
+    bool any_palette_change = update_tile_draw_palette(palette_changed);
+
+    if (g_tile_gpu_active) {
+        sync_tile_atlas();
+    }
+
+    int layer_count = g_tile_layer_count;
+    for (int i = 0; i < layer_count; i++) {
+        TileLayerState& layer = g_tile_layers[i];
+        layer.frame_view = layer.published_view.load();
+
+        // Hidden layers keep their pending work until shown again
+        if (!layer.visible) continue;
+
+        if (!g_tile_gpu_active) {
+            update_tile_layer_ring(layer, any_palette_change ? palette_changed : nullptr);
+            continue;
+        }
+
+        // Quad lists are cheap to rebuild, so any edit invalidates the batch
+        {
+            std::lock_guard<std::mutex> lock(g_tile_edit_mutex);
+            if (!layer.edits.cells.empty() || layer.edits.overflow) {
+                layer.dirty = true;
+            }
+            layer.edits.cells.clear();
+            layer.edits.overflow = false;
+        }
+        if (layer.dirty.exchange(false)) {
+            layer.batch.invalidate();
+        }
+
+        // Animation frames only rewrite texture coordinates of the batch
+        if (any_palette_change) {
+            layer.batch.refresh(g_tile_atlas, g_tile_draw_palette.data());
+        }
+        update_tile_batch(layer);
     }
-    
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, g_tile_view_width, g_tile_view_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba_data);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    
-    delete[] rgba_data;
 }
 
-static void upload_back_tiles_to_texture() {
-    if (!g_tiles_initialized || !g_back_tile_cr) return;
-    
-    // Clear the back tile surface
-    cairo_save(g_back_tile_cr);
-    cairo_set_operator(g_back_tile_cr, CAIRO_OPERATOR_CLEAR);
-    cairo_paint(g_back_tile_cr);
-    cairo_restore(g_back_tile_cr);
-    
-    // Calculate which portion of back world map is visible
-    int world_start_x = (int)(g_back_viewport_x / 128.0f);
-    int world_start_y = (int)(g_back_viewport_y / 128.0f);
-    
-    // Draw tiles from back world map to viewport texture
-    for (int grid_y = 0; grid_y < g_tile_grid_height; grid_y++) {
-        for (int grid_x = 0; grid_x < g_tile_grid_width; grid_x++) {
-            // Calculate world map coordinates
-            int world_x = world_start_x + grid_x;
-            int world_y = world_start_y + grid_y;
-            
-            int tile_id = 0;
-            if (world_x >= 0 && world_x < g_back_world_map_width && 
-                world_y >= 0 && world_y < g_back_world_map_height) {
-                tile_id = g_back_world_map[world_y * g_back_world_map_width + world_x];
+// First atlas batch tile and world pixel at screen (0, 0) for a layer view
+// Uses the same world mapping as the composed path, where screen (0, 0)
+// shows world pixel viewport + 384 (the 3 tile border of the tile view).
+static void get_tile_batch_origin(const TileViewState& view, int* first_x, int* first_y,
+                                  float* world_x, float* world_y) {
+    const int tile_size = AbstractRuntime::TileAtlas::TILE_SIZE;
+    *world_x = view.viewport_x + 384.0f;
+    *world_y = view.viewport_y + 384.0f;
+    *first_x = (int)std::floor(*world_x / tile_size);
+    *first_y = (int)std::floor(*world_y / tile_size);
+}
+
+// Rebuild a layer's atlas batch when the window's first tile changes
+static void update_tile_batch(TileLayerState& layer) {
+    const int tile_size = AbstractRuntime::TileAtlas::TILE_SIZE;
+    int first_x, first_y;
+    float world_x, world_y;
+    get_tile_batch_origin(layer.frame_view, &first_x, &first_y, &world_x, &world_y);
+
+    if (!layer.batch.is_current(first_x, first_y)) {
+        int columns = g_screen_width / tile_size + 2;
+        int rows = g_screen_height / tile_size + 2;
+        layer.batch.build(g_tile_atlas, layer.map, g_tile_draw_palette.data(), first_x, first_y, columns, rows);
+    }
+}
+
+// Draw one tile layer from the atlas (built by update_tile_batch this frame)
+static void render_tile_batch(const TileLayerState& layer) {
+    const int tile_size = AbstractRuntime::TileAtlas::TILE_SIZE;
+    int first_x, first_y;
+    float world_x, world_y;
+    get_tile_batch_origin(layer.frame_view, &first_x, &first_y, &world_x, &world_y);
+
+    layer.batch.draw(g_tile_atlas, first_x * tile_size - world_x, first_y * tile_size - world_y);
+}
+
+// Ring cell holding a world tile index (handles negative indices)
+static int tile_ring_cell(int world_tile, int ring_size) {
+    int cell = world_tile % ring_size;
+    return cell < 0 ? cell + ring_size : cell;
+}
+
+// Compose a rectangle of world tiles into their ring cells
+// The rectangle must lie inside the ring's window (at most one grid in size).
+// With upload set, only the composed cells are copied to the texture.
+static void compose_tile_ring_rect(cairo_surface_t* surface, cairo_t* cr, GLuint texture,
+                                   const AbstractRuntime::TileMap& map,
+                                   int first_x, int first_y, int columns, int rows,
+                                   bool upload) {
+    // Read the rectangle from the chunked map under a single lock
+    static std::vector<uint16_t> cells;
+    cells.resize((size_t)columns * rows);
+    map.read_rect(first_x, first_y, columns, rows, cells.data());
+
+    for (int row = 0; row < rows; row++) {
+        for (int col = 0; col < columns; col++) {
+            int world_x = first_x + col;
+            int world_y = first_y + row;
+            double dest_x = tile_ring_cell(world_x, g_tile_grid_width) * 128.0;
+            double dest_y = tile_ring_cell(world_y, g_tile_grid_height) * 128.0;
+
+            // Clear the cell, it may still hold a tile from the previous window
+            cairo_save(cr);
+            cairo_set_operator(cr, CAIRO_OPERATOR_CLEAR);
+            cairo_rectangle(cr, dest_x, dest_y, 128, 128);
+            cairo_fill(cr);
+            cairo_restore(cr);
+
+            uint16_t cell = cells[(size_t)row * columns + col];
+            int tile_id = cell & TILE_ID_MASK;
+            cairo_surface_t* image = tile_id ? g_tile_surfaces[g_tile_draw_palette[tile_id]] : nullptr;
+            if (!image) continue;
+
+            if ((cell & (TILE_FLIP_X | TILE_FLIP_Y | TILE_ROTATE)) == 0) {
+                cairo_set_source_surface(cr, image, dest_x, dest_y);
+                cairo_rectangle(cr, dest_x, dest_y, 128, 128);
+                cairo_fill(cr);
+                continue;
             }
-            
-            if (tile_id > 0 && tile_id < 256 && g_tile_surfaces[tile_id]) {
-                // Calculate position in tile view (128 pixel grid)
-                double dest_x = grid_x * 128.0;
-                double dest_y = grid_y * 128.0;
-                
-                // Draw tile to Cairo surface
-                cairo_set_source_surface(g_back_tile_cr, g_tile_surfaces[tile_id], dest_x, dest_y);
-                cairo_rectangle(g_back_tile_cr, dest_x, dest_y, 128, 128);
-                cairo_fill(g_back_tile_cr);
+
+            // Flip, then rotate clockwise, about the cell centre
+            cairo_save(cr);
+            cairo_translate(cr, dest_x + 64.0, dest_y + 64.0);
+            if (cell & TILE_ROTATE) cairo_rotate(cr, M_PI / 2.0);
+            cairo_scale(cr, (cell & TILE_FLIP_X) ? -1.0 : 1.0, (cell & TILE_FLIP_Y) ? -1.0 : 1.0);
+            cairo_set_source_surface(cr, image, -64.0, -64.0);
+            cairo_rectangle(cr, -64.0, -64.0, 128, 128);
+            cairo_fill(cr);
+            cairo_restore(cr);
+        }
+    }
+
+    if (!upload) return;
+
+    // Split at the ring seam so each piece is contiguous in the texture
+    cairo_surface_flush(surface);
+    int cell_x = tile_ring_cell(first_x, g_tile_grid_width);
+    int cell_y = tile_ring_cell(first_y, g_tile_grid_height);
+    int piece_x[2] = { cell_x, 0 };
+    int piece_y[2] = { cell_y, 0 };
+    int piece_w[2] = { std::min(columns, g_tile_grid_width - cell_x), 0 };
+    int piece_h[2] = { std::min(rows, g_tile_grid_height - cell_y), 0 };
+    piece_w[1] = columns - piece_w[0];
+    piece_h[1] = rows - piece_h[0];
+
+    for (int py = 0; py < 2; py++) {
+        for (int px = 0; px < 2; px++) {
+            if (piece_w[px] <= 0 || piece_h[py] <= 0) continue;
+            upload_cairo_region_to_texture(surface, texture,
+                                           piece_x[px] * 128, piece_y[py] * 128,
+                                           piece_w[px] * 128, piece_h[py] * 128);
+        }
+    }
+}
+
+// Bring a layer's composed tile view up to the window starting at start_x,
+// start_y. Full rebuilds recompose the whole window in place; a window shift
+// smaller than the window only composes the exposed column and row strips.
+// Returns true when the whole view was recomposed.
+static bool update_tile_ring(TileViewRing& ring, cairo_surface_t* surface, cairo_t* cr,
+                             GLuint texture, bool* allocated,
+                             const AbstractRuntime::TileMap& map,
+                             int start_x, int start_y, bool dirty) {
+    if (!surface || !cr) return false;
+
+    int shift_x = start_x - ring.start_x;
+    int shift_y = start_y - ring.start_y;
+    bool full = dirty || !ring.valid || !*allocated ||
+                std::abs(shift_x) >= g_tile_grid_width ||
+                std::abs(shift_y) >= g_tile_grid_height;
+
+    ring.start_x = start_x;
+    ring.start_y = start_y;
+    ring.valid = true;
+
+    if (full) {
+        compose_tile_ring_rect(surface, cr, texture, map,
+                               start_x, start_y, g_tile_grid_width, g_tile_grid_height, false);
+        upload_cairo_surface_to_texture(surface, texture, allocated, GL_LINEAR);
+
+        // The visible window wraps across the ring seam
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        return true;
+    }
+
+    // Columns exposed on the leading edge
+    if (shift_x > 0) {
+        compose_tile_ring_rect(surface, cr, texture, map,
+                               start_x + g_tile_grid_width - shift_x, start_y,
+                               shift_x, g_tile_grid_height, true);
+    } else if (shift_x < 0) {
+        compose_tile_ring_rect(surface, cr, texture, map,
+                               start_x, start_y, -shift_x, g_tile_grid_height, true);
+    }
+
+    // Rows exposed on the leading edge
+    if (shift_y > 0) {
+        compose_tile_ring_rect(surface, cr, texture, map,
+                               start_x, start_y + g_tile_grid_height - shift_y,
+                               g_tile_grid_width, shift_y, true);
+    } else if (shift_y < 0) {
+        compose_tile_ring_rect(surface, cr, texture, map,
+                               start_x, start_y, g_tile_grid_width, -shift_y, true);
+    }
+
+    return false;
+}
+
+// Redraw edited cells that fall inside the ring's window
+static void compose_tile_ring_edits(const TileViewRing& ring, cairo_surface_t* surface, cairo_t* cr,
+                                    GLuint texture, const AbstractRuntime::TileMap& map,
+                                    std::vector<TileEdit>& edits) {
+    // Coalesce repeated edits of the same cell within the frame
+    std::sort(edits.begin(), edits.end());
+    edits.erase(std::unique(edits.begin(), edits.end()), edits.end());
+
+    for (const TileEdit& edit : edits) {
+        int col = edit.first - ring.start_x;
+        int row = edit.second - ring.start_y;
+        if (col < 0 || col >= g_tile_grid_width || row < 0 || row >= g_tile_grid_height) {
+            continue;  // Off the window; composed when it scrolls into view
+        }
+        compose_tile_ring_rect(surface, cr, texture, map,
+                               edit.first, edit.second, 1, 1, true);
+    }
+}
+
+// Create a layer's composition surface and texture on first use of the
+// Cairo path; surfaces hold a whole number of tiles so they work as rings
+static bool ensure_tile_layer_surface(TileLayerState& layer) {
+    if (layer.cr) return true;
+
+    int ring_width = g_tile_grid_width * 128;
+    int ring_height = g_tile_grid_height * 128;
+    cairo_surface_t* surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, ring_width, ring_height);
+    if (cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS) {
+        std::cerr << "[Runtime] Failed to create tile layer Cairo surface" << std::endl;
+        cairo_surface_destroy(surface);
+        return false;
+    }
+
+    cairo_t* cr = cairo_create(surface);
+    if (cairo_status(cr) != CAIRO_STATUS_SUCCESS) {
+        std::cerr << "[Runtime] Failed to create tile layer Cairo context" << std::endl;
+        cairo_destroy(cr);
+        cairo_surface_destroy(surface);
+        return false;
+    }
+
+    if (!layer.texture) {
+        glGenTextures(1, &layer.texture);
+    }
+    layer.surface = surface;
+    layer.cr = cr;
+    layer.texture_allocated = false;
+    layer.ring.valid = false;
+    return true;
+}
+
+// Apply a layer's full rebuild, viewport shift and cell edits to its ring
+static void update_tile_layer_ring(TileLayerState& layer, const bool* palette_changed) {
+    if (!ensure_tile_layer_surface(layer)) return;
+
+    TileViewRing& ring = layer.ring;
+    bool* allocated = &layer.texture_allocated;
+    const AbstractRuntime::TileMap& map = layer.map;
+
+    const TileViewState& view = layer.frame_view;
+    bool dirty = layer.dirty.exchange(false);
+
+    // Frame-local list keeps its capacity between frames
+    static std::vector<TileEdit> edits;
+    edits.clear();
+    {
+        std::lock_guard<std::mutex> lock(g_tile_edit_mutex);
+        edits.swap(layer.edits.cells);
+        if (layer.edits.overflow) dirty = true;
+        layer.edits.overflow = false;
+    }
+
+    // Cell edits need a composed window to patch
+    if (!ring.valid || !*allocated) {
+        if (!edits.empty()) dirty = true;
+    }
+
+    bool recomposed = false;
+    bool shifted = ring.start_x != view.window_x || ring.start_y != view.window_y;
+    if (dirty || shifted || !ring.valid) {
+        recomposed = update_tile_ring(ring, layer.surface, layer.cr, layer.texture, allocated, map,
+                                      view.window_x, view.window_y, dirty);
+    }
+
+    // Cells whose tile ID now draws a different image (animation frames,
+    // palette swaps) are redrawn like edits
+    if (!recomposed && palette_changed && ring.valid && *allocated) {
+        static std::vector<uint16_t> window;
+        window.resize((size_t)g_tile_grid_width * g_tile_grid_height);
+        map.read_rect(ring.start_x, ring.start_y, g_tile_grid_width, g_tile_grid_height, window.data());
+        for (int row = 0; row < g_tile_grid_height; row++) {
+            for (int col = 0; col < g_tile_grid_width; col++) {
+                int tile_id = window[(size_t)row * g_tile_grid_width + col] & TILE_ID_MASK;
+                if (tile_id && palette_changed[tile_id]) {
+                    edits.push_back(TileEdit(ring.start_x + col, ring.start_y + row));
+                }
             }
         }
     }
-    
-    // Upload Cairo bitmap to OpenGL texture (same as graphics system)
-    glBindTexture(GL_TEXTURE_2D, g_back_tile_texture);
-    
-    // Convert CAIRO_FORMAT_ARGB32 to GL_RGBA
-    unsigned char* rgba_data = new unsigned char[g_tile_view_width * g_tile_view_height * 4];
-    for (int i = 0; i < g_tile_view_width * g_tile_view_height; i++) {
-        // Cairo ARGB32 is stored as BGRA in memory on little-endian
-        rgba_data[i * 4 + 0] = g_back_tile_bitmap[i * 4 + 2]; // R
-        rgba_data[i * 4 + 1] = g_back_tile_bitmap[i * 4 + 1]; // G
-        rgba_data[i * 4 + 2] = g_back_tile_bitmap[i * 4 + 0]; // B
-        rgba_data[i * 4 + 3] = g_back_tile_bitmap[i * 4 + 3]; // A
+
+    if (!recomposed && !edits.empty()) {
+        compose_tile_ring_edits(ring, layer.surface, layer.cr, layer.texture, map, edits);
     }
-    
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, g_tile_view_width, g_tile_view_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba_data);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    
-    delete[] rgba_data;
 }
 
-static void render_tiles_texture_to_screen() {
-    if (!g_tiles_initialized) return;
-    
-    // Render fullscreen quad with tile texture (same as graphics system)
-    glEnable(GL_TEXTURE_2D);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    glBindTexture(GL_TEXTURE_2D, g_tile_texture);
-    
-    // Set up orthographic projection for tile rendering
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    glOrtho(0, g_screen_width, g_screen_height, 0, -1, 1);
-    
-    glMatrixMode(GL_MODELVIEW);
-    glLoadIdentity();
-    
-    // Render tile texture with scrolling offset
-    // Base texture coordinates for the center portion (384px border)
-    float base_tex_left = 384.0f / g_tile_view_width;
-    float base_tex_right = (g_tile_view_width - 384.0f) / g_tile_view_width;
-    float base_tex_top = 384.0f / g_tile_view_height;
-    float base_tex_bottom = (g_tile_view_height - 384.0f) / g_tile_view_height;
-    
-    // Apply scroll offset to texture coordinates
-    float scroll_offset_x = g_tile_scroll_x / g_tile_view_width;
-    float scroll_offset_y = g_tile_scroll_y / g_tile_view_height;
-    
-    float tex_left = base_tex_left + scroll_offset_x;
-    float tex_right = base_tex_right + scroll_offset_x;
-    float tex_top = base_tex_top + scroll_offset_y;
-    float tex_bottom = base_tex_bottom + scroll_offset_y;
-    
-    // Render fullscreen quad with scrolled texture coordinates
+// Draw a composed tile view ring; screen (0, 0) shows the window origin
+// plus the 384 pixel border and the layer's scroll offset
+static void render_tile_ring(const TileViewRing& ring, float scroll_x, float scroll_y) {
+    float ring_width = g_tile_grid_width * 128.0f;
+    float ring_height = g_tile_grid_height * 128.0f;
+    float origin_x = tile_ring_cell(ring.start_x, g_tile_grid_width) * 128.0f + 384.0f + scroll_x;
+    float origin_y = tile_ring_cell(ring.start_y, g_tile_grid_height) * 128.0f + 384.0f + scroll_y;
+
+    // Coordinates past 1.0 wrap around the ring (GL_REPEAT)
+    float tex_left = origin_x / ring_width;
+    float tex_right = (origin_x + g_screen_width) / ring_width;
+    float tex_top = origin_y / ring_height;
+    float tex_bottom = (origin_y + g_screen_height) / ring_height;
+
     glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
     glBegin(GL_QUADS);
     glTexCoord2f(tex_left, tex_top);    glVertex2f(0, 0);
@@ -930,54 +1522,43 @@ static void render_tiles_texture_to_screen() {
     glTexCoord2f(tex_right, tex_bottom); glVertex2f(g_screen_width, g_screen_height);
     glTexCoord2f(tex_left, tex_bottom);  glVertex2f(0, g_screen_height);
     glEnd();
-    
-    glDisable(GL_TEXTURE_2D);
-    glDisable(GL_BLEND);
 }
 
-static void render_back_tiles_texture_to_screen() {
+// Draw every visible tile layer, back to front
+static void render_tile_layers() {
     if (!g_tiles_initialized) return;
-    
-    // Render fullscreen quad with back tile texture (renders first/behind)
+
     glEnable(GL_TEXTURE_2D);
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    glBindTexture(GL_TEXTURE_2D, g_back_tile_texture);
-    
+
     // Set up orthographic projection for tile rendering
     glMatrixMode(GL_PROJECTION);
     glLoadIdentity();
     glOrtho(0, g_screen_width, g_screen_height, 0, -1, 1);
-    
+
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
-    
-    // Render back tile texture with independent scrolling offset
-    // Base texture coordinates for the center portion (384px border)
-    float base_tex_left = 384.0f / g_tile_view_width;
-    float base_tex_right = (g_tile_view_width - 384.0f) / g_tile_view_width;
-    float base_tex_top = 384.0f / g_tile_view_height;
-    float base_tex_bottom = (g_tile_view_height - 384.0f) / g_tile_view_height;
-    
-    // Apply back layer scroll offset to texture coordinates
-    float scroll_offset_x = g_back_tile_scroll_x / g_tile_view_width;
-    float scroll_offset_y = g_back_tile_scroll_y / g_tile_view_height;
-    
-    float tex_left = base_tex_left + scroll_offset_x;
-    float tex_right = base_tex_right + scroll_offset_x;
-    float tex_top = base_tex_top + scroll_offset_y;
-    float tex_bottom = base_tex_bottom + scroll_offset_y;
-    
-    // Render fullscreen quad with scrolled texture coordinates
-    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-    glBegin(GL_QUADS);
-    glTexCoord2f(tex_left, tex_top);    glVertex2f(0, 0);
-    glTexCoord2f(tex_right, tex_top);   glVertex2f(g_screen_width, 0);
-    glTexCoord2f(tex_right, tex_bottom); glVertex2f(g_screen_width, g_screen_height);
-    glTexCoord2f(tex_left, tex_bottom);  glVertex2f(0, g_screen_height);
-    glEnd();
-    
+
+    int layer_count = g_tile_layer_count;
+    for (int i = 0; i < layer_count; i++) {
+        TileLayerState& layer = g_tile_layers[i];
+        if (!layer.visible) continue;
+
+        // GPU path: one batched draw from the tile atlas
+        if (g_tile_gpu_active) {
+            render_tile_batch(layer);
+            continue;
+        }
+
+        // Composed view ring, offset by the layer scroll
+        if (!layer.texture_allocated) continue;
+        glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, layer.texture);
+        render_tile_ring(layer.ring, layer.frame_view.scroll_x, layer.frame_view.scroll_y);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
     glDisable(GL_TEXTURE_2D);
     glDisable(GL_BLEND);
 }
@@ -996,26 +1577,8 @@ static void render_sprites() {
 
 static void upload_graphics_to_texture() {
     // Upload graphics bitmap to OpenGL texture
-    glBindTexture(GL_TEXTURE_2D, g_graphics_texture);
-
-    // Convert CAIRO_FORMAT_ARGB32 to GL_RGBA
-    unsigned char* rgba_data = new unsigned char[g_screen_width * g_screen_height * 4];
-    for (int i = 0; i < g_screen_width * g_screen_height; i++) {
-        // Cairo ARGB32 is stored as BGRA in memory on little-endian
-        rgba_data[i * 4 + 0] = g_graphics_bitmap[i * 4 + 2]; // R
-        rgba_data[i * 4 + 1] = g_graphics_bitmap[i * 4 + 1]; // G
-        rgba_data[i * 4 + 2] = g_graphics_bitmap[i * 4 + 0]; // B
-        rgba_data[i * 4 + 3] = g_graphics_bitmap[i * 4 + 3]; // A
-    }
-
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, g_screen_width, g_screen_height,
-                 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba_data);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-    delete[] rgba_data;
+    upload_cairo_surface_to_texture(g_graphics_surface, g_graphics_texture,
+                                    &g_graphics_texture_allocated, GL_NEAREST);
 }
 
 static void render_graphics_texture_to_screen() {
@@ -1048,166 +1611,352 @@ static void render_graphics_texture_to_screen() {
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
-static void upload_text_to_texture() {
-    std::lock_guard<std::mutex> lock(g_text_mutex);
-    
-    // Clear text bitmap (transparent background)
-    memset(g_text_bitmap, 0, g_screen_width * g_screen_height * 4);
+// Write one RGBA pixel into the text bitmap (caller clips)
+static inline void put_text_pixel(int x, int y, int r, int g, int b, int a) {
+    unsigned char* pixel = g_text_bitmap + (y * g_screen_width + x) * 4;
+    pixel[0] = r;
+    pixel[1] = g;
+    pixel[2] = b;
+    pixel[3] = a;
+}
 
-    // Render each character cell from text buffer
-    for (int row = 0; row < g_text_rows; row++) {
-        for (int col = 0; col < g_text_columns; col++) {
-            // Calculate character cell position with baseline
-            int cell_x = col * 16 + 15; // 16 pixels per character + margin
-            int cell_y = row * 24 + 50; // 24 pixels per line + margin for better spacing
-            int baseline_y = cell_y + 14; // Baseline is 14 pixels from top of cell
-            
-            // Get colors for this cell
-            int paper_r, paper_g, paper_b, paper_a;
-            int ink_r, ink_g, ink_b, ink_a;
-            unpack_rgba(g_text_paper_colors[row][col], &paper_r, &paper_g, &paper_b, &paper_a);
-            unpack_rgba(g_text_ink_colors[row][col], &ink_r, &ink_g, &ink_b, &ink_a);
-            
-            // Draw background (paper) if not transparent
-            if (paper_a > 0) {
-                // Draw background for full character cell (24 pixels high to match row spacing)
-                for (int py = 0; py < 24 && (cell_y + py) < g_screen_height; py++) {
-                    for (int px = 0; px < 16 && (cell_x + px) < g_screen_width; px++) {
-                        int tx = cell_x + px;
-                        int ty = cell_y + py;
-                        if (tx >= 0 && ty >= 0) {
-                            int pixel_index = (ty * g_screen_width + tx) * 4;
-                            g_text_bitmap[pixel_index + 0] = paper_r;
-                            g_text_bitmap[pixel_index + 1] = paper_g;
-                            g_text_bitmap[pixel_index + 2] = paper_b;
-                            g_text_bitmap[pixel_index + 3] = paper_a;
-                        }
-                    }
-                }
-            }
-            
-            // Draw character (foreground) if not space
-            uint32_t unicode_char = g_text_buffer[row][col];
-            if (unicode_char != 0x20 && unicode_char != 0 && ink_a > 0) {
-                // Load character glyph using Unicode codepoint
-                if (FT_Load_Char(g_ft_face, unicode_char, FT_LOAD_RENDER) == 0) {
-                    FT_GlyphSlot glyph = g_ft_face->glyph;
-
-                    // Copy glyph bitmap to text bitmap using baseline positioning
-                    for (int gy = 0; gy < (int)glyph->bitmap.rows; gy++) {
-                        for (int gx = 0; gx < (int)glyph->bitmap.width; gx++) {
-                            int tx = cell_x + gx + glyph->bitmap_left;
-                            int ty = baseline_y + gy - glyph->bitmap_top;
-
-                            if (tx >= 0 && tx < g_screen_width && ty >= 0 && ty < g_screen_height) {
-                                // Handle FreeType pitch correctly
-                                int glyph_index = gy * glyph->bitmap.pitch + gx;
-                                unsigned char glyph_alpha = glyph->bitmap.buffer[glyph_index];
-                                
-                                if (glyph_alpha > 0) {
-                                    int pixel_index = (ty * g_screen_width + tx) * 4;
-                                    // Blend glyph alpha with ink alpha
-                                    int final_alpha = (glyph_alpha * ink_a) / 255;
-                                    g_text_bitmap[pixel_index + 0] = ink_r;
-                                    g_text_bitmap[pixel_index + 1] = ink_g;
-                                    g_text_bitmap[pixel_index + 2] = ink_b;
-                                    g_text_bitmap[pixel_index + 3] = final_alpha;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+// Fill a rectangle of the text bitmap, clipped to the screen
+static void fill_text_bitmap_rect(int x, int y, int width, int height,
+                                  int r, int g, int b, int a) {
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + width, g_screen_width);
+    int y1 = std::min(y + height, g_screen_height);
+    for (int py = y0; py < y1; py++) {
+        for (int px = x0; px < x1; px++) {
+            put_text_pixel(px, py, r, g, b, a);
         }
     }
+}
 
-    // Render cursor overlay if visible
-    if (g_text_cursor.visible && g_text_cursor.x >= 0 && g_text_cursor.x < g_text_columns && 
-        g_text_cursor.y >= 0 && g_text_cursor.y < g_text_rows) {
-        
-        // Handle cursor blinking
-        bool should_draw_cursor = true;
-        if (g_text_cursor.blink_enabled) {
-            uint64_t current_time = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::steady_clock::now().time_since_epoch()).count();
-            
-            // Blink every 500ms
-            if (current_time - g_text_cursor.last_blink_time > 500) {
-                g_text_cursor.blink_state = !g_text_cursor.blink_state;
-                g_text_cursor.last_blink_time = current_time;
+// Re-rasterise a single text cell: clear, paper, then glyph clipped to the cell
+// The bitmap is laid out by physical row; the ring offset is applied when
+// the texture is drawn. Reads the published front buffer, so no lock is needed
+static void rasterize_text_cell(int col, int row) {
+    int cell_x = col * g_text_cell_width + g_text_origin_x;
+    int cell_y = row * g_text_cell_height + g_text_origin_y;
+    int baseline_y = cell_y + g_text_baseline;
+
+    // Get colors for this cell
+    int paper_r, paper_g, paper_b, paper_a;
+    int ink_r, ink_g, ink_b, ink_a;
+    size_t index = text_physical_index(col, row);
+    unpack_rgba(g_text_front.paper_colors[index], &paper_r, &paper_g, &paper_b, &paper_a);
+    unpack_rgba(g_text_front.ink_colors[index], &ink_r, &ink_g, &ink_b, &ink_a);
+
+    // Background (paper) covers the full cell; transparent paper clears it
+    fill_text_bitmap_rect(cell_x, cell_y, g_text_cell_width, g_text_cell_height,
+                          paper_r, paper_g, paper_b, paper_a);
+
+    // Draw character (foreground) if not space
+    uint32_t unicode_char = g_text_front.text_buffer[index];
+    if (unicode_char == 0x20 || unicode_char == 0 || ink_a == 0) {
+        return;
+    }
+
+    // Look up the pre-rendered glyph (FreeType only runs on a cache miss)
+    const AbstractRuntime::CachedGlyph* glyph = g_glyph_cache.get_glyph(unicode_char);
+    if (!glyph) {
+        return;
+    }
+
+    // Glyphs are clipped to their own cell so a cell can be redrawn in isolation
+    int clip_x0 = std::max(cell_x, 0);
+    int clip_y0 = std::max(cell_y, 0);
+    int clip_x1 = std::min(cell_x + g_text_cell_width, g_screen_width);
+    int clip_y1 = std::min(cell_y + g_text_cell_height, g_screen_height);
+
+    for (int gy = 0; gy < glyph->rows; gy++) {
+        int ty = baseline_y + gy - glyph->top;
+        if (ty < clip_y0 || ty >= clip_y1) continue;
+
+        const uint8_t* coverage = &glyph->coverage[gy * glyph->width];
+        for (int gx = 0; gx < glyph->width; gx++) {
+            int tx = cell_x + gx + glyph->left;
+            if (tx < clip_x0 || tx >= clip_x1) continue;
+
+            unsigned char glyph_alpha = coverage[gx];
+            if (glyph_alpha > 0) {
+                // Blend glyph alpha with ink alpha
+                int final_alpha = (glyph_alpha * ink_a) / 255;
+                put_text_pixel(tx, ty, ink_r, ink_g, ink_b, final_alpha);
             }
-            should_draw_cursor = g_text_cursor.blink_state;
         }
-        
-        if (should_draw_cursor) {
-            // Calculate cursor position using same positioning as text rendering
-            int cursor_cell_x = g_text_cursor.x * 16 + 15;
-            int cursor_cell_y = g_text_cursor.y * 24 + 50;
-            int baseline_y = cursor_cell_y + 14; // Same baseline as text rendering
-            
-            // Get cursor color components
-            int cursor_r, cursor_g, cursor_b, cursor_a;
-            unpack_rgba(g_text_cursor.color, &cursor_r, &cursor_g, &cursor_b, &cursor_a);
-            
-            // Draw cursor based on type
-            switch (g_text_cursor.type) {
-                case CURSOR_UNDERSCORE:
-                    // Draw underscore at bottom of character cell
-                    for (int cy = baseline_y + 2; cy < baseline_y + 5 && cy < g_screen_height; cy++) {
-                        for (int cx = cursor_cell_x; cx < cursor_cell_x + 16 && cx < g_screen_width; cx++) {
-                            if (cx >= 0 && cy >= 0) {
-                                int pixel_index = (cy * g_screen_width + cx) * 4;
-                                // Alpha blend cursor color with existing pixel
-                                g_text_bitmap[pixel_index + 0] = cursor_r;
-                                g_text_bitmap[pixel_index + 1] = cursor_g;
-                                g_text_bitmap[pixel_index + 2] = cursor_b;
-                                g_text_bitmap[pixel_index + 3] = cursor_a;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case CURSOR_BLOCK:
-                    // Draw full character block
-                    for (int cy = cursor_cell_y; cy < cursor_cell_y + 24 && cy < g_screen_height; cy++) {
-                        for (int cx = cursor_cell_x; cx < cursor_cell_x + 16 && cx < g_screen_width; cx++) {
-                            if (cx >= 0 && cy >= 0) {
-                                int pixel_index = (cy * g_screen_width + cx) * 4;
-                                g_text_bitmap[pixel_index + 0] = cursor_r;
-                                g_text_bitmap[pixel_index + 1] = cursor_g;
-                                g_text_bitmap[pixel_index + 2] = cursor_b;
-                                g_text_bitmap[pixel_index + 3] = cursor_a;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case CURSOR_VERTICAL_BAR:
-                    // Draw vertical bar at left edge of character cell
-                    for (int cy = cursor_cell_y; cy < cursor_cell_y + 24 && cy < g_screen_height; cy++) {
-                        for (int cx = cursor_cell_x; cx < cursor_cell_x + 2 && cx < g_screen_width; cx++) {
-                            if (cx >= 0 && cy >= 0) {
-                                int pixel_index = (cy * g_screen_width + cx) * 4;
-                                g_text_bitmap[pixel_index + 0] = cursor_r;
-                                g_text_bitmap[pixel_index + 1] = cursor_g;
-                                g_text_bitmap[pixel_index + 2] = cursor_b;
-                                g_text_bitmap[pixel_index + 3] = cursor_a;
-                            }
-                        }
-                    }
-                    break;
+    }
+}
+
+// Advance the cursor blink timer
+// The cursor is an overlay, so a toggle never touches the text layer
+// Note: Caller must hold g_text_mutex
+static void update_cursor_blink() {
+    if (!g_text_cursor.visible || !g_text_cursor.blink_enabled) return;
+
+    uint64_t current_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    // Blink every 500ms
+    if (current_time - g_text_cursor.last_blink_time > 500) {
+        g_text_cursor.blink_state = !g_text_cursor.blink_state;
+        g_text_cursor.last_blink_time = current_time;
+    }
+}
+
+// Upload a pixel rectangle of the text bitmap into the existing texture
+static void upload_text_bitmap_rect(int x, int y, int width, int height) {
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + width, g_screen_width);
+    int y1 = std::min(y + height, g_screen_height);
+    if (x1 <= x0 || y1 <= y0) return;
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, g_screen_width);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x0, y0, x1 - x0, y1 - y0,
+                    GL_RGBA, GL_UNSIGNED_BYTE,
+                    g_text_bitmap + (y0 * g_screen_width + x0) * 4);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
+// Push published dirty cells into the GPU text grid vertex buffer
+static void update_gpu_text_grid() {
+    AbstractRuntime::TextRenderer* renderer = AbstractRuntime::get_text_renderer();
+    const TextFrontBuffer& front = g_text_front;
+
+    for (int row = 0; row < g_text_rows; row++) {
+        int first_col = 0;
+        int last_col = g_text_columns - 1;
+        if (!front.dirty_all) {
+            first_col = front.dirty_spans[row].min_col;
+            last_col = front.dirty_spans[row].max_col;
+            if (last_col < first_col) continue;
+        }
+
+        size_t index = text_physical_index(first_col, row);
+        renderer->update_grid_cells(row, first_col, last_col - first_col + 1,
+                                    &front.text_buffer[index],
+                                    &front.ink_colors[index],
+                                    &front.paper_colors[index]);
+    }
+}
+
+// Copy the writers' dirty cells into the front buffer (copy-on-publish)
+// Only changed spans are copied, so the lock is held for a few memcpys
+// Note: Caller must hold g_text_mutex
+static void publish_text_front() {
+    TextFrontBuffer& front = g_text_front;
+
+    if (g_text_dirty_all) {
+        // Same size, so these are straight copies with no reallocation
+        front.text_buffer = g_text_buffer;
+        front.ink_colors = g_text_ink_colors;
+        front.paper_colors = g_text_paper_colors;
+        front.dirty_all = true;
+    } else {
+        for (int row = 0; row < g_text_rows; row++) {
+            const TextDirtySpan& span = g_text_dirty_spans[row];
+            if (span.max_col < span.min_col) continue;
+
+            size_t first = text_physical_index(span.min_col, row);
+            size_t bytes = (size_t)(span.max_col - span.min_col + 1) * sizeof(uint32_t);
+            memcpy(&front.text_buffer[first], &g_text_buffer[first], bytes);
+            memcpy(&front.ink_colors[first], &g_text_ink_colors[first], bytes);
+            memcpy(&front.paper_colors[first], &g_text_paper_colors[first], bytes);
+
+            TextDirtySpan& pending = front.dirty_spans[row];
+            pending.min_col = std::min(pending.min_col, span.min_col);
+            pending.max_col = std::max(pending.max_col, span.max_col);
+        }
+    }
+    front.dirty = true;
+}
+
+// Compose the paged-back view (history then live rows) into the front buffer
+// The composed grid is in logical order, so it is published with first_row 0
+// Note: Caller must hold g_text_mutex
+static void publish_text_scrollback_view() {
+    TextFrontBuffer& front = g_text_front;
+    const TextScrollback& history = g_text_scrollback;
+    size_t row_bytes = g_text_columns * sizeof(uint32_t);
+
+    for (int row = 0; row < g_text_rows; row++) {
+        int line = history.count - history.view + row;
+        size_t dst = text_physical_index(0, row);
+        if (line < history.count) {
+            size_t src = (size_t)((history.head + line) % history.capacity) * g_text_columns;
+            memcpy(&front.text_buffer[dst], &history.text_buffer[src], row_bytes);
+            memcpy(&front.ink_colors[dst], &history.ink_colors[src], row_bytes);
+            memcpy(&front.paper_colors[dst], &history.paper_colors[src], row_bytes);
+        } else {
+            size_t src = text_index(0, line - history.count);
+            memcpy(&front.text_buffer[dst], &g_text_buffer[src], row_bytes);
+            memcpy(&front.ink_colors[dst], &g_text_ink_colors[src], row_bytes);
+            memcpy(&front.paper_colors[dst], &g_text_paper_colors[src], row_bytes);
+        }
+    }
+    front.dirty_all = true;
+    front.dirty = true;
+}
+
+// Snapshot the ring offset and fine scroll for this frame
+// Note: Caller must hold g_text_mutex
+static void publish_text_scroll() {
+    bool paged = g_text_scrollback.view > 0;
+    g_text_front.first_row = paged ? 0 : g_text_first_row;
+    g_text_front.scroll_x = g_text_scroll_x;
+    g_text_front.scroll_y = g_text_scroll_y;
+
+    // The cursor belongs to the live grid; hide it while viewing history
+    if (paged) {
+        g_cursor_snapshot.visible = false;
+    }
+}
+
+// Mark everything in the front buffer as drawn
+static void clear_text_front_dirty() {
+    for (TextDirtySpan& span : g_text_front.dirty_spans) {
+        span.min_col = g_text_columns;
+        span.max_col = -1;
+    }
+    g_text_front.dirty_all = false;
+    g_text_front.dirty = false;
+}
+
+static void upload_text_to_texture() {
+    {
+        // Publish under the lock; everything below works on the front copy
+        std::lock_guard<std::mutex> lock(g_text_mutex);
+
+        update_cursor_blink();
+        g_cursor_snapshot = g_text_cursor;
+        publish_text_scroll();
+
+        // Switching paths redraws everything through the new one
+        bool use_gpu = g_text_gpu_requested && AbstractRuntime::get_text_renderer() != nullptr;
+        if (use_gpu != g_text_gpu_active) {
+            g_text_gpu_active = use_gpu;
+            mark_text_all_dirty();
+        }
+
+        if (g_text_dirty) {
+            if (g_text_scrollback.view > 0) {
+                publish_text_scrollback_view();
+            } else {
+                publish_text_front();
             }
+            clear_text_dirty_state();
         }
     }
 
-    // Upload text bitmap to OpenGL texture
+    TextFrontBuffer& front = g_text_front;
+    if (!front.dirty) {
+        return;
+    }
+
+    if (g_text_gpu_active) {
+        update_gpu_text_grid();
+        clear_text_front_dirty();
+        return;
+    }
+
     glBindTexture(GL_TEXTURE_2D, g_text_texture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, g_screen_width, g_screen_height,
-                 0, GL_RGBA, GL_UNSIGNED_BYTE, g_text_bitmap);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // Texture storage is allocated once; everything after is a sub-upload
+    if (!g_text_texture_allocated) {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, g_screen_width, g_screen_height,
+                     0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        g_text_texture_allocated = true;
+        front.dirty_all = true;
+    }
+
+    if (front.dirty_all) {
+        // Whole layer changed (clear, scroll, restore): redraw every cell once
+        memset(g_text_bitmap, 0, g_screen_width * g_screen_height * 4);
+        for (int row = 0; row < g_text_rows; row++) {
+            for (int col = 0; col < g_text_columns; col++) {
+                rasterize_text_cell(col, row);
+            }
+        }
+        upload_text_bitmap_rect(0, 0, g_screen_width, g_screen_height);
+    } else {
+        // Redraw and upload only the dirty span of each row
+        for (int row = 0; row < g_text_rows; row++) {
+            const TextDirtySpan& span = front.dirty_spans[row];
+            if (span.max_col < span.min_col) continue;
+
+            for (int col = span.min_col; col <= span.max_col; col++) {
+                rasterize_text_cell(col, row);
+            }
+
+            upload_text_bitmap_rect(span.min_col * g_text_cell_width + g_text_origin_x,
+                                    row * g_text_cell_height + g_text_origin_y,
+                                    (span.max_col - span.min_col + 1) * g_text_cell_width,
+                                    g_text_cell_height);
+        }
+    }
+
+    clear_text_front_dirty();
+}
+
+// Draw the cursor as a solid quad over the text layer (both render paths)
+static void render_text_cursor_overlay() {
+    const TextCursor& cursor = g_cursor_snapshot;
+    if (!cursor.visible || !cursor.blink_state) return;
+    if (cursor.x < 0 || cursor.x >= g_text_columns || cursor.y < 0 || cursor.y >= g_text_rows) return;
+
+    int cell_x = cursor.x * g_text_cell_width + g_text_origin_x + g_text_front.scroll_x;
+    int cell_y = cursor.y * g_text_cell_height + g_text_origin_y + g_text_front.scroll_y;
+    int x = cell_x;
+    int y = cell_y;
+    int w = g_text_cell_width;
+    int h = g_text_cell_height;
+
+    switch (cursor.type) {
+        case CURSOR_UNDERSCORE:
+            // Underscore just below the baseline
+            y = cell_y + g_text_baseline + 2;
+            h = 3;
+            break;
+        case CURSOR_BLOCK:
+            break;
+        case CURSOR_VERTICAL_BAR:
+            w = 2;
+            break;
+    }
+
+    int r, g, b, a;
+    unpack_rgba(cursor.color, &r, &g, &b, &a);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glColor4ub(r, g, b, a);
+    glBegin(GL_QUADS);
+        glVertex2i(x, y);
+        glVertex2i(x + w, y);
+        glVertex2i(x + w, y + h);
+        glVertex2i(x, y + h);
+    glEnd();
+    glDisable(GL_BLEND);
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+// Emit a full-width quad mapping text bitmap rows [src_y, src_y + height)
+// to the screen at (dst_x, dst_y). Must be called between glBegin/glEnd.
+static void draw_text_texture_band(int src_y, int height, float dst_x, float dst_y) {
+    float v0 = (float)src_y / g_screen_height;
+    float v1 = (float)(src_y + height) / g_screen_height;
+
+    glTexCoord2f(0, v0); glVertex2f(dst_x, dst_y);
+    glTexCoord2f(1, v0); glVertex2f(dst_x + g_screen_width, dst_y);
+    glTexCoord2f(1, v1); glVertex2f(dst_x + g_screen_width, dst_y + height);
+    glTexCoord2f(0, v1); glVertex2f(dst_x, dst_y + height);
 }
 
 static void render_text_texture_to_screen() {
@@ -1219,6 +1968,17 @@ static void render_text_texture_to_screen() {
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
 
+    const TextFrontBuffer& front = g_text_front;
+
+    // GPU path: one batched draw from the font atlas, cursor as an overlay
+    if (g_text_gpu_active) {
+        AbstractRuntime::TextRenderer* renderer = AbstractRuntime::get_text_renderer();
+        renderer->set_grid_scroll(front.first_row, (float)front.scroll_x, (float)front.scroll_y);
+        renderer->render_grid(g_screen_width, g_screen_height);
+        render_text_cursor_overlay();
+        return;
+    }
+
     // Render text layer on top with blending
     glEnable(GL_TEXTURE_2D);
     glEnable(GL_BLEND);
@@ -1226,17 +1986,27 @@ static void render_text_texture_to_screen() {
     
     glBindTexture(GL_TEXTURE_2D, g_text_texture);
 
+    // The bitmap holds rows in ring order: draw physical rows
+    // [first_row, rows) at the top of the grid, then [0, first_row) below
+    int grid_height = g_text_rows * g_text_cell_height;
+    int split = front.first_row * g_text_cell_height;
+    float dx = (float)front.scroll_x;
+    float dy = (float)(g_text_origin_y + front.scroll_y);
+
     glColor3f(1.0f, 1.0f, 1.0f);
     glBegin(GL_QUADS);
-        glTexCoord2f(0, 0); glVertex2f(0, 0);
-        glTexCoord2f(1, 0); glVertex2f(g_screen_width, 0);
-        glTexCoord2f(1, 1); glVertex2f(g_screen_width, g_screen_height);
-        glTexCoord2f(0, 1); glVertex2f(0, g_screen_height);
+        draw_text_texture_band(g_text_origin_y + split, grid_height - split, dx, dy);
+        if (split > 0) {
+            draw_text_texture_band(g_text_origin_y, split, dx, dy + grid_height - split);
+        }
     glEnd();
 
     glDisable(GL_TEXTURE_2D);
     glDisable(GL_BLEND);
     glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Cursor is drawn over the text texture, never into it
+    render_text_cursor_overlay();
 }
 
 static void render_fps_overlay() {
@@ -1264,21 +2034,19 @@ static void render_fps_overlay() {
     for (int i = 0; i < text_len; i++) {
         char ch = fps_text[i];
         if (ch != ' ' && ch != '\0') {
-            if (FT_Load_Char(g_ft_face, ch, FT_LOAD_RENDER) == 0) {
-                FT_GlyphSlot glyph = g_ft_face->glyph;
-                
+            const AbstractRuntime::CachedGlyph* glyph = g_glyph_cache.get_glyph((unsigned char)ch);
+            if (glyph) {
                 int char_x = 4 + i * char_width;  // Small left padding
                 int char_y = 2;  // Small top padding
                 
                 // Copy glyph to FPS bitmap (yellow text)
-                for (int gy = 0; gy < (int)glyph->bitmap.rows; gy++) {
-                    for (int gx = 0; gx < (int)glyph->bitmap.width; gx++) {
-                        int tx = char_x + gx + glyph->bitmap_left;
-                        int ty = char_y + gy + (char_height - glyph->bitmap_top);
+                for (int gy = 0; gy < glyph->rows; gy++) {
+                    for (int gx = 0; gx < glyph->width; gx++) {
+                        int tx = char_x + gx + glyph->left;
+                        int ty = char_y + gy + (char_height - glyph->top);
                         
                         if (tx >= 0 && tx < fps_width && ty >= 0 && ty < fps_height) {
-                            int glyph_index = gy * glyph->bitmap.pitch + gx;
-                            unsigned char alpha = glyph->bitmap.buffer[glyph_index];
+                            unsigned char alpha = glyph->coverage[gy * glyph->width + gx];
                             
                             if (alpha > 0) {
                                 int pixel_index = (ty * fps_width + tx) * 4;
@@ -1366,14 +2134,15 @@ void print_at(int x, int y, const char* text) {
 
     std::lock_guard<std::mutex> lock(g_text_mutex);
     int len = strlen(text);
-    for (int i = 0; i < len && (x + i) < g_text_columns; i++) {
+    int i = 0;
+    for (; i < len && (x + i) < g_text_columns; i++) {
         unsigned char ch = (unsigned char)text[i];
-        g_text_buffer[y][x + i] = ch;  // Store as Unicode codepoint directly
+        g_text_buffer[text_index(x + i, y)] = ch;  // Store as Unicode codepoint directly
         // Set colors for this character position
-        g_text_ink_colors[y][x + i] = g_current_ink_color;
-        g_text_paper_colors[y][x + i] = g_current_paper_color;
+        g_text_ink_colors[text_index(x + i, y)] = g_current_ink_color;
+        g_text_paper_colors[text_index(x + i, y)] = g_current_paper_color;
     }
-    g_text_dirty = true;  // Mark text for upload
+    mark_text_span_dirty(y, x, x + i - 1);  // Mark written cells for upload
 }
 
 // UTF-8 decoding helper function
@@ -1423,14 +2192,14 @@ void print_at_utf8(int x, int y, const char* utf8_text) {
     while (*str && col < g_text_columns) {
         uint32_t codepoint = decode_utf8_char(str);
         if (codepoint != 0) {
-            g_text_buffer[y][col] = codepoint;
+            g_text_buffer[text_index(col, y)] = codepoint;
             // Set colors for this character position
-            g_text_ink_colors[y][col] = g_current_ink_color;
-            g_text_paper_colors[y][col] = g_current_paper_color;
+            g_text_ink_colors[text_index(col, y)] = g_current_ink_color;
+            g_text_paper_colors[text_index(col, y)] = g_current_paper_color;
             col++;
         }
     }
-    g_text_dirty = true;  // Mark text for upload
+    mark_text_span_dirty(y, x, col - 1);  // Mark written cells for upload
 }
 
 void print_at_no_color(int x, int y, const char* text) {
@@ -1443,10 +2212,10 @@ void print_at_no_color(int x, int y, const char* text) {
     if (len > max_chars) len = max_chars;
     
     for (int i = 0; i < len; i++) {
-        g_text_buffer[y][x + i] = (uint32_t)(unsigned char)text[i];
+        g_text_buffer[text_index(x + i, y)] = (uint32_t)(unsigned char)text[i];
         // Do NOT change colors - leave existing colors intact
     }
-    g_text_dirty = true;  // Mark text for upload
+    mark_text_span_dirty(y, x, x + len - 1);  // Mark written cells for upload
 }
 
 void print_at_utf8_no_color(int x, int y, const char* utf8_text) {
@@ -1460,84 +2229,238 @@ void print_at_utf8_no_color(int x, int y, const char* utf8_text) {
     while (*str && col < g_text_columns) {
         uint32_t codepoint = decode_utf8_char(str);
         if (codepoint != 0) {
-            g_text_buffer[y][col] = codepoint;
+            g_text_buffer[text_index(col, y)] = codepoint;
             // Do NOT change colors - leave existing colors intact
             col++;
         }
     }
-    g_text_dirty = true;  // Mark text for upload
+    mark_text_span_dirty(y, x, col - 1);  // Mark written cells for upload
 }
 
 void clear_text() {
+    if (!g_initialized) return;
+
     std::lock_guard<std::mutex> lock(g_text_mutex);
     // Clear text buffer (without internal lock since we already have it)
     for (int row = 0; row < g_text_rows; row++) {
         for (int col = 0; col < g_text_columns; col++) {
-            g_text_buffer[row][col] = 0x20; // Unicode space
+            g_text_buffer[text_index(col, row)] = 0x20; // Unicode space
         }
     }
     init_text_colors();
-    g_text_dirty = true;  // Mark text for upload
+    g_text_scrollback.view = 0;  // Show the (now empty) live screen
+    mark_text_all_dirty();  // Mark text for upload
 }
 
-void scroll_text(int dx, int dy) {
-    // For now, only implement vertical scrolling
-    if (dy > 0) {
-        for (int i = 0; i < dy; i++) {
-            scroll_text_down();
-        }
-    } else if (dy < 0) {
-        for (int i = 0; i < -dy; i++) {
-            scroll_text_up();
+// Clear one logical row to spaces in the current colors
+// Note: Caller must hold g_text_mutex
+static void clear_text_row(int row) {
+    size_t first = text_index(0, row);
+    std::fill_n(&g_text_buffer[first], g_text_columns, 0x20u);  // Unicode space
+    std::fill_n(&g_text_ink_colors[first], g_text_columns, g_current_ink_color);
+    std::fill_n(&g_text_paper_colors[first], g_text_columns, g_current_paper_color);
+}
+
+// Copy a logical grid row into the scrollback ring, dropping the oldest
+// line when full. A paged-back view stays on the same history lines.
+// Note: Caller must hold g_text_mutex
+static void push_text_scrollback_row(int row) {
+    TextScrollback& history = g_text_scrollback;
+    if (history.capacity <= 0) return;
+
+    int slot;
+    if (history.count < history.capacity) {
+        slot = (history.head + history.count) % history.capacity;
+        history.count++;
+    } else {
+        slot = history.head;
+        history.head = (history.head + 1) % history.capacity;
+    }
+
+    size_t dst = (size_t)slot * g_text_columns;
+    size_t src = text_index(0, row);
+    size_t row_bytes = g_text_columns * sizeof(uint32_t);
+    memcpy(&history.text_buffer[dst], &g_text_buffer[src], row_bytes);
+    memcpy(&history.ink_colors[dst], &g_text_ink_colors[src], row_bytes);
+    memcpy(&history.paper_colors[dst], &g_text_paper_colors[src], row_bytes);
+
+    if (history.view > 0) {
+        history.view = std::min(history.view + 1, history.count);
+    }
+}
+
+// Scroll the grid by whole rows through the ring mapping (positive = down)
+// Only the newly exposed rows are cleared and marked dirty; nothing moves.
+// Note: Caller must hold g_text_mutex
+static void scroll_text_rows(int rows) {
+    if (rows == 0 || g_text_rows <= 0) return;
+
+    int count = std::min(std::abs(rows), g_text_rows);
+    for (int i = 0; i < count; i++) {
+        if (rows < 0) {
+            // Content moves up: the old top row goes to the scrollback and
+            // its storage becomes the new bottom row
+            push_text_scrollback_row(0);
+            g_text_first_row = (g_text_first_row + 1) % g_text_rows;
+            clear_text_row(g_text_rows - 1);
+            mark_text_span_dirty(g_text_rows - 1, 0, g_text_columns - 1);
+        } else {
+            // Content moves down: the old bottom row becomes the new top row
+            g_text_first_row = (g_text_first_row + g_text_rows - 1) % g_text_rows;
+            clear_text_row(0);
+            mark_text_span_dirty(0, 0, g_text_columns - 1);
         }
     }
 }
 
-void scroll_text_up() {
+void scroll_text(int dx, int dy) {
     if (!g_initialized) return;
-    
+
     std::lock_guard<std::mutex> lock(g_text_mutex);
-    // Move all rows up by one
-    for (int row = 0; row < g_text_rows - 1; row++) {
-        memcpy(g_text_buffer[row], g_text_buffer[row + 1], g_text_columns * sizeof(uint32_t));
-        // Move color maps too
-        memcpy(g_text_ink_colors[row], g_text_ink_colors[row + 1], g_text_columns * sizeof(uint32_t));
-        memcpy(g_text_paper_colors[row], g_text_paper_colors[row + 1], g_text_columns * sizeof(uint32_t));
+    g_text_scroll_x += dx;
+    g_text_scroll_y += dy;
+
+    // Whenever a full row has scrolled past, hand it to the ring and keep
+    // the remainder as the fine offset, so the motion stays continuous
+    int rows = g_text_scroll_y / g_text_cell_height;
+    if (rows != 0) {
+        scroll_text_rows(rows);
+        g_text_scroll_y -= rows * g_text_cell_height;
     }
+}
+
+void scroll_text_lines(int lines) {
+    if (!g_initialized) return;
+
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    scroll_text_rows(lines);
+}
+
+void get_text_scroll_offset(int* dx, int* dy) {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    if (dx) *dx = g_text_scroll_x;
+    if (dy) *dy = g_text_scroll_y;
+}
+
+void scroll_text_up() {
+    if (!g_initialized) return;
     
-    // Clear the last row
-    for (int col = 0; col < g_text_columns; col++) {
-        g_text_buffer[g_text_rows - 1][col] = 0x20; // Unicode space
-        g_text_ink_colors[g_text_rows - 1][col] = g_current_ink_color;
-        g_text_paper_colors[g_text_rows - 1][col] = g_current_paper_color;
-    }
-    g_text_dirty = true;  // Mark text for upload
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    scroll_text_rows(-1);  // Top line disappears, bottom line becomes empty
 }
 
 void scroll_text_down() {
     if (!g_initialized) return;
     
     std::lock_guard<std::mutex> lock(g_text_mutex);
-    // Move all rows down by one
-    for (int row = g_text_rows - 1; row > 0; row--) {
-        memcpy(g_text_buffer[row], g_text_buffer[row - 1], g_text_columns * sizeof(uint32_t));
-        // Move color maps too
-        memcpy(g_text_ink_colors[row], g_text_ink_colors[row - 1], g_text_columns * sizeof(uint32_t));
-        memcpy(g_text_paper_colors[row], g_text_paper_colors[row - 1], g_text_columns * sizeof(uint32_t));
+    scroll_text_rows(1);  // Bottom line disappears, top line becomes empty
+}
+
+void append_text_line(const char* utf8_text) {
+    if (!g_initialized || !utf8_text) return;
+
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    const char* str = utf8_text;
+    int bottom = g_text_rows - 1;
+
+    // Each output row scrolls the grid up one line (feeding the scrollback)
+    // and fills the new bottom row; long lines wrap onto further rows
+    do {
+        scroll_text_rows(-1);
+        int col = 0;
+        while (*str && col < g_text_columns) {
+            uint32_t codepoint = decode_utf8_char(str);
+            if (codepoint == '\n') break;
+            if (codepoint != 0) {
+                size_t index = text_index(col, bottom);
+                g_text_buffer[index] = codepoint;
+                g_text_ink_colors[index] = g_current_ink_color;
+                g_text_paper_colors[index] = g_current_paper_color;
+                col++;
+            }
+        }
+        // A newline right after a full row ends the row the wrap already ended
+        if (col == g_text_columns && *str == '\n') str++;
+    } while (*str);
+}
+
+// =============================================================================
+// TEXT SCROLLBACK API
+// =============================================================================
+
+bool set_text_scrollback_size(int lines) {
+    if (lines < 0) return false;
+
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    TextScrollback& history = g_text_scrollback;
+    history.capacity = lines;
+    history.count = 0;
+    history.head = 0;
+    history.view = 0;
+
+    // Storage is sized now if the grid exists, otherwise at init
+    size_t history_cells = g_initialized ? (size_t)lines * g_text_columns : 0;
+    history.text_buffer.assign(history_cells, 0x20);
+    history.ink_colors.assign(history_cells, 0xFFFFFFFF);
+    history.paper_colors.assign(history_cells, 0x00000000);
+    history.text_buffer.shrink_to_fit();
+    history.ink_colors.shrink_to_fit();
+    history.paper_colors.shrink_to_fit();
+
+    mark_text_all_dirty();
+    return true;
+}
+
+int get_text_scrollback_size() {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    return g_text_scrollback.capacity;
+}
+
+int get_text_scrollback_count() {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    return g_text_scrollback.count;
+}
+
+// Move the visible window, clamped to the stored history
+// Note: Caller must hold g_text_mutex
+static void move_text_scrollback_view(int lines_back) {
+    TextScrollback& history = g_text_scrollback;
+    int view = std::max(0, std::min(lines_back, history.count));
+    if (view != history.view) {
+        history.view = view;
+        mark_text_all_dirty();  // Recompose the visible window
     }
-    
-    // Clear the first row
-    for (int col = 0; col < g_text_columns; col++) {
-        g_text_buffer[0][col] = 0x20; // Unicode space
-        g_text_ink_colors[0][col] = g_current_ink_color;
-        g_text_paper_colors[0][col] = g_current_paper_color;
+}
+
+void set_text_scrollback_view(int lines_back) {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    move_text_scrollback_view(lines_back);
+}
+
+int get_text_scrollback_view() {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    return g_text_scrollback.view;
+}
+
+void page_text_scrollback(int pages) {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    move_text_scrollback_view(g_text_scrollback.view + pages * g_text_rows);
+}
+
+void clear_text_scrollback() {
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    TextScrollback& history = g_text_scrollback;
+    if (history.view > 0) {
+        mark_text_all_dirty();
     }
-    g_text_dirty = true;  // Mark text for upload
+    history.count = 0;
+    history.head = 0;
+    history.view = 0;
 }
 
 // Text buffer access functions for screen save/restore
 void get_text_buffer_cell(int x, int y, uint32_t* text, uint32_t* ink, uint32_t* paper) {
-    if (x < 0 || y < 0 || x >= g_text_columns || y >= g_text_rows) {
+    if (!g_initialized || x < 0 || y < 0 || x >= g_text_columns || y >= g_text_rows) {
         if (text) *text = 0x20; // space
         if (ink) *ink = 0xFFFFFFFF; // white
         if (paper) *paper = 0x000000FF; // black
@@ -1545,37 +2468,141 @@ void get_text_buffer_cell(int x, int y, uint32_t* text, uint32_t* ink, uint32_t*
     }
     
     std::lock_guard<std::mutex> lock(g_text_mutex);
-    if (text) *text = g_text_buffer[y][x];
-    if (ink) *ink = g_text_ink_colors[y][x];
-    if (paper) *paper = g_text_paper_colors[y][x];
+    if (text) *text = g_text_buffer[text_index(x, y)];
+    if (ink) *ink = g_text_ink_colors[text_index(x, y)];
+    if (paper) *paper = g_text_paper_colors[text_index(x, y)];
 }
 
 void set_text_buffer_cell(int x, int y, uint32_t text, uint32_t ink, uint32_t paper) {
-    if (x < 0 || y < 0 || x >= g_text_columns || y >= g_text_rows) {
+    if (!g_initialized || x < 0 || y < 0 || x >= g_text_columns || y >= g_text_rows) {
         return;
     }
     
     std::lock_guard<std::mutex> lock(g_text_mutex);
-    g_text_buffer[y][x] = text;
-    g_text_ink_colors[y][x] = ink;
-    g_text_paper_colors[y][x] = paper;
+    g_text_buffer[text_index(x, y)] = text;
+    g_text_ink_colors[text_index(x, y)] = ink;
+    g_text_paper_colors[text_index(x, y)] = paper;
+    mark_text_cell_dirty(x, y);
+}
+
+int write_text_cells(const TextCellWrite* cells, int count) {
+    if (!g_initialized || !cells || count <= 0) return 0;
+
+    int written = 0;
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    for (int i = 0; i < count; i++) {
+        const TextCellWrite& cell = cells[i];
+        if (cell.x < 0 || cell.y < 0 || cell.x >= g_text_columns || cell.y >= g_text_rows) {
+            continue;
+        }
+
+        size_t index = text_index(cell.x, cell.y);
+        if (cell.mask & TEXT_WRITE_CHAR) g_text_buffer[index] = cell.codepoint;
+        if (cell.mask & TEXT_WRITE_INK) g_text_ink_colors[index] = cell.ink;
+        if (cell.mask & TEXT_WRITE_PAPER) g_text_paper_colors[index] = cell.paper;
+        mark_text_cell_dirty(cell.x, cell.y);  // Only widens the row span
+        written++;
+    }
+    return written;
+}
+
+void write_text_block(int x, int y, int width, int height,
+                      const uint32_t* codepoints,
+                      const uint32_t* ink,
+                      const uint32_t* paper) {
+    if (!g_initialized || width <= 0 || height <= 0) return;
+    if (!codepoints && !ink && !paper) return;
+
+    // Clip to the grid, remembering where the clipped block starts in the source
+    int start_x = std::max(x, 0);
+    int start_y = std::max(y, 0);
+    int end_x = std::min(x + width, g_text_columns);
+    int end_y = std::min(y + height, g_text_rows);
+    if (start_x >= end_x || start_y >= end_y) return;
+
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    for (int row = start_y; row < end_y; row++) {
+        size_t src = (size_t)(row - y) * width + (start_x - x);
+        size_t dst = text_index(start_x, row);
+        int run = end_x - start_x;
+
+        if (codepoints) {
+            for (int i = 0; i < run; i++) {
+                if (codepoints[src + i] != 0) g_text_buffer[dst + i] = codepoints[src + i];
+            }
+        }
+        if (ink) {
+            memcpy(&g_text_ink_colors[dst], &ink[src], run * sizeof(uint32_t));
+        }
+        if (paper) {
+            memcpy(&g_text_paper_colors[dst], &paper[src], run * sizeof(uint32_t));
+        }
+    }
+    mark_text_rect_dirty(start_x, start_y, end_x - start_x, end_y - start_y);
 }
 
 static void clear_text_buffer() {
     // Note: This function assumes caller already holds g_text_mutex
     for (int row = 0; row < g_text_rows; row++) {
         for (int col = 0; col < g_text_columns; col++) {
-            g_text_buffer[row][col] = 0x20; // Unicode space
+            g_text_buffer[text_index(col, row)] = 0x20; // Unicode space
         }
     }
 }
 
+// =============================================================================
+// TEXT DIRTY TRACKING
+// =============================================================================
+// Writers record which cells changed; upload_text_to_texture() re-rasterises
+// and sub-uploads only those. All functions assume g_text_mutex is held.
+
+static void mark_text_span_dirty(int row, int first_col, int last_col) {
+    if (row < 0 || row >= (int)g_text_dirty_spans.size()) return;  // Spans are sized at init
+    first_col = std::max(first_col, 0);
+    last_col = std::min(last_col, g_text_columns - 1);
+    if (last_col < first_col) return;
+
+    TextDirtySpan& span = g_text_dirty_spans[text_physical_row(row)];
+    if (span.max_col < span.min_col) {
+        span.min_col = first_col;
+        span.max_col = last_col;
+    } else {
+        span.min_col = std::min(span.min_col, first_col);
+        span.max_col = std::max(span.max_col, last_col);
+    }
+    g_text_dirty = true;
+}
+
+static void mark_text_cell_dirty(int col, int row) {
+    mark_text_span_dirty(row, col, col);
+}
+
+static void mark_text_rect_dirty(int x, int y, int width, int height) {
+    for (int row = y; row < y + height; row++) {
+        mark_text_span_dirty(row, x, x + width - 1);
+    }
+}
+
+static void mark_text_all_dirty() {
+    g_text_dirty_all = true;
+    g_text_dirty = true;
+}
+
+static void clear_text_dirty_state() {
+    for (int row = 0; row < g_text_rows; row++) {
+        g_text_dirty_spans[row].min_col = g_text_columns;
+        g_text_dirty_spans[row].max_col = -1;
+    }
+    g_text_dirty_all = false;
+    g_text_dirty = false;
+}
+
 // Initialize text color maps
 static void init_text_colors() {
-    for (int row = 0; row < 25; row++) {
-        for (int col = 0; col < 80; col++) {
-            g_text_ink_colors[row][col] = 0xFFFFFFFF;   // Opaque white ink
-            g_text_paper_colors[row][col] = 0x00000000; // Fully transparent by default
+    for (int row = 0; row < g_text_rows; row++) {
+        for (int col = 0; col < g_text_columns; col++) {
+            g_text_ink_colors[text_index(col, row)] = 0xFFFFFFFF;   // Opaque white ink
+            g_text_paper_colors[text_index(col, row)] = 0x00000000; // Fully transparent by default
         }
     }
     g_current_ink_color = 0xFFFFFFFF;   // Default: opaque white
@@ -1622,52 +2649,34 @@ void set_text_color(int r, int g, int b) {
 void set_cursor_position(int x, int y) {
     if (x >= 0 && x < g_text_columns && y >= 0 && y < g_text_rows) {
         std::lock_guard<std::mutex> lock(g_text_mutex);
-        // Only mark dirty if position actually changed
-        if (g_text_cursor.x != x || g_text_cursor.y != y) {
-            g_text_cursor.x = x;
-            g_text_cursor.y = y;
-            g_text_dirty = true;
-        }
+        // The overlay picks up the new position next frame; no text redraw
+        g_text_cursor.x = x;
+        g_text_cursor.y = y;
     }
 }
 
 void set_cursor_visible(bool visible) {
     std::lock_guard<std::mutex> lock(g_text_mutex);
-    // Only mark dirty if visibility actually changed
-    if (g_text_cursor.visible != visible) {
-        g_text_cursor.visible = visible;
-        g_text_dirty = true;
-    }
+    g_text_cursor.visible = visible;
 }
 
 void set_cursor_type(int type) {
     std::lock_guard<std::mutex> lock(g_text_mutex);
     if (type >= 0 && type <= 2) {
-        // Only mark dirty if type actually changed
-        if (g_text_cursor.type != (CursorType)type) {
-            g_text_cursor.type = (CursorType)type;
-            g_text_dirty = true;
-        }
+        g_text_cursor.type = (CursorType)type;
     }
 }
 
 void set_cursor_color(int r, int g, int b, int a) {
     std::lock_guard<std::mutex> lock(g_text_mutex);
-    uint32_t new_color = pack_rgba(r, g, b, a);
-    // Only mark dirty if color actually changed
-    if (g_text_cursor.color != new_color) {
-        g_text_cursor.color = new_color;
-        g_text_dirty = true;
-    }
+    g_text_cursor.color = pack_rgba(r, g, b, a);
 }
 
 void enable_cursor_blink(bool enable) {
     std::lock_guard<std::mutex> lock(g_text_mutex);
-    // Only mark dirty if blink setting actually changed
     if (g_text_cursor.blink_enabled != enable) {
         g_text_cursor.blink_enabled = enable;
         g_text_cursor.blink_state = true; // Reset to visible when changing blink state
-        g_text_dirty = true;
     }
 }
 
@@ -1679,13 +2688,14 @@ void fill_color_map(int start_x, int start_y, int width, int height,
                    int ink_r, int ink_g, int ink_b, int ink_a,
                    int paper_r, int paper_g, int paper_b, int paper_a) {
     
-    // Bounds checking
+    // Bounds checking (storage is sized at init)
+    if (!g_initialized) return;
     if (start_x < 0 || start_y < 0 || width <= 0 || height <= 0) return;
-    if (start_x >= 80 || start_y >= 25) return;
+    if (start_x >= g_text_columns || start_y >= g_text_rows) return;
     
     // Clamp to screen boundaries
-    int end_x = std::min(start_x + width, 80);
-    int end_y = std::min(start_y + height, 25);
+    int end_x = std::min(start_x + width, g_text_columns);
+    int end_y = std::min(start_y + height, g_text_rows);
     int actual_width = end_x - start_x;
     
     if (actual_width <= 0) return;
@@ -1700,25 +2710,26 @@ void fill_color_map(int start_x, int start_y, int width, int height,
     // Fill each row efficiently
     for (int y = start_y; y < end_y; y++) {
         for (int x = start_x; x < end_x; x++) {
-            g_text_ink_colors[y][x] = ink_color;
-            g_text_paper_colors[y][x] = paper_color;
+            g_text_ink_colors[text_index(x, y)] = ink_color;
+            g_text_paper_colors[text_index(x, y)] = paper_color;
         }
     }
     
-    // Mark text as dirty to trigger re-render
-    g_text_dirty = true;
+    // Mark filled cells as dirty to trigger re-render
+    mark_text_rect_dirty(start_x, start_y, end_x - start_x, end_y - start_y);
 }
 
 void fill_paper_map(int start_x, int start_y, int width, int height,
                    int paper_r, int paper_g, int paper_b, int paper_a) {
     
-    // Bounds checking
+    // Bounds checking (storage is sized at init)
+    if (!g_initialized) return;
     if (start_x < 0 || start_y < 0 || width <= 0 || height <= 0) return;
-    if (start_x >= 80 || start_y >= 25) return;
+    if (start_x >= g_text_columns || start_y >= g_text_rows) return;
     
     // Clamp to screen boundaries
-    int end_x = std::min(start_x + width, 80);
-    int end_y = std::min(start_y + height, 25);
+    int end_x = std::min(start_x + width, g_text_columns);
+    int end_y = std::min(start_y + height, g_text_rows);
     
     if (end_x <= start_x) return;
     
@@ -1731,24 +2742,25 @@ void fill_paper_map(int start_x, int start_y, int width, int height,
     // Fill each row efficiently
     for (int y = start_y; y < end_y; y++) {
         for (int x = start_x; x < end_x; x++) {
-            g_text_paper_colors[y][x] = paper_color;
+            g_text_paper_colors[text_index(x, y)] = paper_color;
         }
     }
     
-    // Mark text as dirty to trigger re-render
-    g_text_dirty = true;
+    // Mark filled cells as dirty to trigger re-render
+    mark_text_rect_dirty(start_x, start_y, end_x - start_x, end_y - start_y);
 }
 
 void fill_ink_map(int start_x, int start_y, int width, int height,
                  int ink_r, int ink_g, int ink_b, int ink_a) {
     
-    // Bounds checking
+    // Bounds checking (storage is sized at init)
+    if (!g_initialized) return;
     if (start_x < 0 || start_y < 0 || width <= 0 || height <= 0) return;
-    if (start_x >= 80 || start_y >= 25) return;
+    if (start_x >= g_text_columns || start_y >= g_text_rows) return;
     
     // Clamp to screen boundaries
-    int end_x = std::min(start_x + width, 80);
-    int end_y = std::min(start_y + height, 25);
+    int end_x = std::min(start_x + width, g_text_columns);
+    int end_y = std::min(start_y + height, g_text_rows);
     
     if (end_x <= start_x) return;
     
@@ -1761,42 +2773,46 @@ void fill_ink_map(int start_x, int start_y, int width, int height,
     // Fill each row efficiently
     for (int y = start_y; y < end_y; y++) {
         for (int x = start_x; x < end_x; x++) {
-            g_text_ink_colors[y][x] = ink_color;
+            g_text_ink_colors[text_index(x, y)] = ink_color;
         }
     }
     
-    // Mark text as dirty to trigger re-render
-    g_text_dirty = true;
+    // Mark filled cells as dirty to trigger re-render
+    mark_text_rect_dirty(start_x, start_y, end_x - start_x, end_y - start_y);
 }
 
 void poke_text_ink(int x, int y, int r, int g, int b, int a) {
     if (!g_initialized) return;
     if (x < 0 || y < 0 || x >= g_text_columns || y >= g_text_rows) return;
     
-    g_text_ink_colors[y][x] = pack_rgba(r, g, b, a);
-    g_text_dirty = true;  // Mark text for upload
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    g_text_ink_colors[text_index(x, y)] = pack_rgba(r, g, b, a);
+    mark_text_cell_dirty(x, y);  // Mark cell for upload
 }
 
 void poke_text_paper(int x, int y, int r, int g, int b, int a) {
     if (!g_initialized) return;
     if (x < 0 || y < 0 || x >= g_text_columns || y >= g_text_rows) return;
     
-    g_text_paper_colors[y][x] = pack_rgba(r, g, b, a);
-    g_text_dirty = true;  // Mark text for upload
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    g_text_paper_colors[text_index(x, y)] = pack_rgba(r, g, b, a);
+    mark_text_cell_dirty(x, y);  // Mark cell for upload
 }
 
 void peek_text_ink(int x, int y, int* r, int* g, int* b, int* a) {
     if (!g_initialized) return;
     if (x < 0 || y < 0 || x >= g_text_columns || y >= g_text_rows) return;
     
-    unpack_rgba(g_text_ink_colors[y][x], r, g, b, a);
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    unpack_rgba(g_text_ink_colors[text_index(x, y)], r, g, b, a);
 }
 
 void peek_text_paper(int x, int y, int* r, int* g, int* b, int* a) {
     if (!g_initialized) return;
     if (x < 0 || y < 0 || x >= g_text_columns || y >= g_text_rows) return;
     
-    unpack_rgba(g_text_paper_colors[y][x], r, g, b, a);
+    std::lock_guard<std::mutex> lock(g_text_mutex);
+    unpack_rgba(g_text_paper_colors[text_index(x, y)], r, g, b, a);
 }
 
 void fill_text_color(int x, int y, int width, int height, 
@@ -1817,15 +2833,16 @@ void fill_text_color(int x, int y, int width, int height,
     uint32_t paper_color = pack_rgba(paper_r, paper_g, paper_b, paper_a);
     
     // Fill the rectangular region
+    std::lock_guard<std::mutex> lock(g_text_mutex);
     for (int row = y; row < end_y; row++) {
         // Use memset-style operation for cache efficiency
         for (int col = x; col < end_x; col++) {
-            g_text_ink_colors[row][col] = ink_color;
-            g_text_paper_colors[row][col] = paper_color;
+            g_text_ink_colors[text_index(col, row)] = ink_color;
+            g_text_paper_colors[text_index(col, row)] = paper_color;
         }
     }
     
-    g_text_dirty = true;  // Mark text for upload
+    mark_text_rect_dirty(x, y, end_x - x, end_y - y);  // Mark filled cells for upload
 }
 
 void fill_text_ink(int x, int y, int width, int height, int r, int g, int b, int a) {
@@ -1843,13 +2860,14 @@ void fill_text_ink(int x, int y, int width, int height, int r, int g, int b, int
     uint32_t ink_color = pack_rgba(r, g, b, a);
     
     // Fill the rectangular region
+    std::lock_guard<std::mutex> lock(g_text_mutex);
     for (int row = y; row < end_y; row++) {
         for (int col = x; col < end_x; col++) {
-            g_text_ink_colors[row][col] = ink_color;
+            g_text_ink_colors[text_index(col, row)] = ink_color;
         }
     }
     
-    g_text_dirty = true;  // Mark text for upload
+    mark_text_rect_dirty(x, y, end_x - x, end_y - y);  // Mark filled cells for upload
 }
 
 void fill_text_paper(int x, int y, int width, int height, int r, int g, int b, int a) {
@@ -1867,13 +2885,14 @@ void fill_text_paper(int x, int y, int width, int height, int r, int g, int b, i
     uint32_t paper_color = pack_rgba(r, g, b, a);
     
     // Fill the rectangular region
+    std::lock_guard<std::mutex> lock(g_text_mutex);
     for (int row = y; row < end_y; row++) {
         for (int col = x; col < end_x; col++) {
-            g_text_paper_colors[row][col] = paper_color;
+            g_text_paper_colors[text_index(col, row)] = paper_color;
         }
     }
     
-    g_text_dirty = true;  // Mark text for upload
+    mark_text_rect_dirty(x, y, end_x - x, end_y - y);  // Mark filled cells for upload
 }
 
 void clear_text_colors(void) {
@@ -1883,14 +2902,15 @@ void clear_text_colors(void) {
     uint32_t default_paper = pack_rgba(0, 0, 0, 0);         // Transparent black
     
     // Fill entire screen with default colors
+    std::lock_guard<std::mutex> lock(g_text_mutex);
     for (int row = 0; row < g_text_rows; row++) {
         for (int col = 0; col < g_text_columns; col++) {
-            g_text_ink_colors[row][col] = default_ink;
-            g_text_paper_colors[row][col] = default_paper;
+            g_text_ink_colors[text_index(col, row)] = default_ink;
+            g_text_paper_colors[text_index(col, row)] = default_paper;
         }
     }
     
-    g_text_dirty = true;  // Mark text for upload
+    mark_text_all_dirty();  // Mark text for upload
 }
 
 void wait_for_render_complete(void) {
@@ -1919,12 +2939,22 @@ void save_text(int slot) {
     
     // Copy current screen state to backup slot using efficient bulk operations
     TextBackup& backup = g_text_backups[slot];
-    
-    // Copy text buffer
+    std::lock_guard<std::mutex> text_lock(g_text_mutex);
+    
+    // Copy text buffer (backups are sized to the grid they were taken from)
+    // Rows are copied in logical order so the ring offset is not saved
+    backup.columns = g_text_columns;
+    backup.rows = g_text_rows;
+    backup.text_buffer.resize(g_text_buffer.size());
+    backup.ink_colors.resize(g_text_ink_colors.size());
+    backup.paper_colors.resize(g_text_paper_colors.size());
+    size_t row_bytes = g_text_columns * sizeof(uint32_t);
     for (int row = 0; row < g_text_rows; row++) {
-        memcpy(backup.text_buffer[row], g_text_buffer[row], g_text_columns * sizeof(uint32_t));
-        memcpy(backup.ink_colors[row], g_text_ink_colors[row], g_text_columns * sizeof(uint32_t));
-        memcpy(backup.paper_colors[row], g_text_paper_colors[row], g_text_columns * sizeof(uint32_t));
+        size_t dst = (size_t)row * g_text_columns;
+        size_t src = text_index(0, row);
+        memcpy(&backup.text_buffer[dst], &g_text_buffer[src], row_bytes);
+        memcpy(&backup.ink_colors[dst], &g_text_ink_colors[src], row_bytes);
+        memcpy(&backup.paper_colors[dst], &g_text_paper_colors[src], row_bytes);
     }
 }
 
@@ -1941,15 +2971,21 @@ bool restore_text(int slot) {
     
     // Restore from backup slot
     const TextBackup& backup = g_text_backups[slot];
+    std::lock_guard<std::mutex> text_lock(g_text_mutex);
     
     // Copy backup to current screen state using efficient bulk operations
-    for (int row = 0; row < g_text_rows; row++) {
-        memcpy(g_text_buffer[row], backup.text_buffer[row], g_text_columns * sizeof(uint32_t));
-        memcpy(g_text_ink_colors[row], backup.ink_colors[row], g_text_columns * sizeof(uint32_t));
-        memcpy(g_text_paper_colors[row], backup.paper_colors[row], g_text_columns * sizeof(uint32_t));
-    }
-    
-    g_text_dirty = true;  // Mark text for upload
+    // (an empty slot or different grid size restores the overlapping area)
+    int rows = std::min(backup.rows, g_text_rows);
+    int cols = std::min(backup.columns, g_text_columns);
+    for (int row = 0; row < rows; row++) {
+        size_t src = (size_t)row * backup.columns;
+        size_t dst = text_index(0, row);
+        memcpy(&g_text_buffer[dst], &backup.text_buffer[src], cols * sizeof(uint32_t));
+        memcpy(&g_text_ink_colors[dst], &backup.ink_colors[src], cols * sizeof(uint32_t));
+        memcpy(&g_text_paper_colors[dst], &backup.paper_colors[src], cols * sizeof(uint32_t));
+    }
+    
+    mark_text_all_dirty();  // Mark text for upload
     return true;
 }
 
@@ -2046,6 +3082,20 @@ int get_screen_height() {
     return g_screen_height;
 }
 
+bool set_text_grid_size(int columns, int rows) {
+    if (g_initialized) return false;
+    if (columns < 0 || rows < 0 || columns > 1024 || rows > 1024) return false;
+
+    g_text_columns_override = columns;
+    g_text_rows_override = rows;
+    return true;
+}
+
+void get_text_grid_size(int* columns, int* rows) {
+    if (columns) *columns = g_text_columns;
+    if (rows) *rows = g_text_rows;
+}
+
 // =============================================================================
 // CLEANUP
 // =============================================================================
@@ -2063,38 +3113,25 @@ static void cleanup_all() {
         g_sprite_bank = nullptr;
     }
     
-    // Cleanup front tile system
-    if (g_tile_cr) {
-        cairo_destroy(g_tile_cr);
-        g_tile_cr = nullptr;
-    }
-    if (g_tile_surface) {
-        cairo_surface_destroy(g_tile_surface);
-        g_tile_surface = nullptr;
-    }
-    if (g_tile_bitmap) {
-        g_tile_bitmap = nullptr; // Points to Cairo surface data, don't delete
-    }
-    if (g_world_map) {
-        delete[] g_world_map;
-        g_world_map = nullptr;
-    }
-    
-    // Cleanup back tile system
-    if (g_back_tile_cr) {
-        cairo_destroy(g_back_tile_cr);
-        g_back_tile_cr = nullptr;
-    }
-    if (g_back_tile_surface) {
-        cairo_surface_destroy(g_back_tile_surface);
-        g_back_tile_surface = nullptr;
-    }
-    if (g_back_tile_bitmap) {
-        g_back_tile_bitmap = nullptr; // Points to Cairo surface data, don't delete
-    }
-    if (g_back_world_map) {
-        delete[] g_back_world_map;
-        g_back_world_map = nullptr;
+    // Cleanup tile layers
+    for (TileLayerState& layer : g_tile_layers) {
+        if (layer.cr) {
+            cairo_destroy(layer.cr);
+            layer.cr = nullptr;
+        }
+        if (layer.surface) {
+            cairo_surface_destroy(layer.surface);
+            layer.surface = nullptr;
+        }
+        if (layer.texture) {
+            glDeleteTextures(1, &layer.texture);
+            layer.texture = 0;
+        }
+        layer.texture_allocated = false;
+        layer.map.release();
+        layer.ring.valid = false;
+        layer.edits.cells.clear();
+        layer.batch.invalidate();
     }
     // Cleanup loaded tile surfaces
     for (int i = 0; i < 256; i++) {
@@ -2103,12 +3140,9 @@ static void cleanup_all() {
             g_tile_surfaces[i] = nullptr;
         }
     }
-    if (g_tile_texture) {
-        glDeleteTextures(1, &g_tile_texture);
-    }
-    if (g_back_tile_texture) {
-        glDeleteTextures(1, &g_back_tile_texture);
-    }
+    g_tile_atlas.shutdown();
+    g_tile_gpu_active = false;
+    g_graphics_texture_allocated = false;
     g_sprites_initialized = false;
 
     if (g_graphics_texture) {
@@ -2124,6 +3158,9 @@ static void cleanup_all() {
         delete[] g_graphics_bitmap;
     }
 
+    AbstractRuntime::shutdown_text_renderer();
+    AbstractRuntime::shutdown_font_atlas();
+
     if (g_text_texture) {
         glDeleteTextures(1, &g_text_texture);
     }
@@ -2131,6 +3168,9 @@ static void cleanup_all() {
         delete[] g_text_bitmap;
     }
 
+    // Release cached glyphs before the face they were rendered from
+    g_glyph_cache.set_face(nullptr);
+
     if (g_ft_face) {
         FT_Done_Face(g_ft_face);
     }
@@ -2180,6 +3220,22 @@ bool sprite(int instance_id, int sprite_slot, int x, int y) {
     return g_sprite_renderer->sprite(instance_id, sprite_slot, (float)x, (float)y);
 }
 
+int sprite_create(int sprite_slot, int x, int y) {
+    if (!g_sprite_renderer) {
+        return -1;
+    }
+    
+    return g_sprite_renderer->sprite_create(sprite_slot, (float)x, (float)y);
+}
+
+bool sprite_destroy(int instance_id) {
+    if (!g_sprite_renderer) {
+        return false;
+    }
+    
+    return g_sprite_renderer->sprite_destroy(instance_id);
+}
+
 bool sprite_move(int instance_id, int x, int y) {
     if (!g_sprite_renderer) {
         return false;
@@ -2220,6 +3276,27 @@ bool sprite_z_order(int instance_id, int z_order) {
     return g_sprite_renderer->sprite_z_order(instance_id, z_order);
 }
 
+int sprite_update_many(const int* ids, const float* xs, const float* ys,
+                       const float* rotations, const float* scales,
+                       const float* alphas, int count) {
+    if (!g_sprite_renderer) {
+        return 0;
+    }
+    
+    return g_sprite_renderer->sprite_update_many(ids, xs, ys, rotations, scales, alphas, count);
+}
+
+extern "C" int sprite_update_transforms(const SpriteTransform* transforms, int count) {
+    if (!g_sprite_renderer || !transforms) {
+        return 0;
+    }
+    
+    // The fields are read in place as strided arrays
+    return g_sprite_renderer->sprite_update_many(&transforms[0].id, &transforms[0].x, &transforms[0].y,
+                                                 &transforms[0].rotation, &transforms[0].scale,
+                                                 &transforms[0].alpha, count, sizeof(SpriteTransform));
+}
+
 bool sprite_hide(int instance_id) {
     if (!g_sprite_renderer) {
         return false;
@@ -2258,10 +3335,52 @@ int get_active_sprite_count() {
     return g_sprite_renderer->get_active_count();
 }
 
+void begin_sprite_updates() {
+    if (g_sprite_renderer) {
+        g_sprite_renderer->begin_updates();
+    }
+}
+
+void commit_sprite_updates() {
+    if (g_sprite_renderer) {
+        g_sprite_renderer->commit_updates();
+    }
+}
+
+unsigned int get_sprite_publish_count() {
+    if (!g_sprite_renderer) {
+        return 0;
+    }
+    
+    return g_sprite_renderer->get_publish_count();
+}
+
 // =============================================================================
 // TILE SYSTEM API
 // =============================================================================
 
+// Give a layer's world map its size and allocate it (chunks are allocated
+// as tiles are written). Layers without a size follow the front layer, which
+// defaults to the viewport grid. A map file opened earlier is kept.
+static void init_tile_layer_map(TileLayerState& layer) {
+    if (layer.map.is_allocated()) {
+        return;
+    }
+
+    TileLayerState& front = g_tile_layers[TILE_LAYER_FRONT];
+    if (front.map_width == 0 || front.map_height == 0) {
+        front.map_width = g_tile_grid_width;
+        front.map_height = g_tile_grid_height;
+    }
+    if (layer.map_width == 0 || layer.map_height == 0) {
+        layer.map_width = front.map_width;
+        layer.map_height = front.map_height;
+    }
+
+    layer.map.reset(layer.map_width, layer.map_height);
+    layer.dirty = true;
+}
+
 bool init_tiles() {
     if (g_tiles_initialized) {
         return true;
@@ -2280,97 +3399,24 @@ bool init_tiles() {
     
     std::cout << "[Runtime] Calculated grid: " << g_tile_grid_width << "x" << g_tile_grid_height << std::endl;
     
-    // Initialize front layer world map size (same as viewport if not set)
-    if (g_world_map_width == 0 || g_world_map_height == 0) {
-        g_world_map_width = g_tile_grid_width;
-        g_world_map_height = g_tile_grid_height;
-    }
-    
-    // Initialize back layer world map size (same as front if not set)
-    if (g_back_world_map_width == 0 || g_back_world_map_height == 0) {
-        g_back_world_map_width = g_world_map_width;
-        g_back_world_map_height = g_world_map_height;
-    }
-    
-    // Allocate front layer world map
-    if (!g_world_map) {
-        g_world_map = new int[g_world_map_width * g_world_map_height];
-        memset(g_world_map, 0, g_world_map_width * g_world_map_height * sizeof(int));
-    }
-    
-    // Allocate back layer world map
-    if (!g_back_world_map) {
-        g_back_world_map = new int[g_back_world_map_width * g_back_world_map_height];
-        memset(g_back_world_map, 0, g_back_world_map_width * g_back_world_map_height * sizeof(int));
-    }
-    
-    // Create Cairo surface for front tile composition
-    g_tile_surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, g_tile_view_width, g_tile_view_height);
-    if (cairo_surface_status(g_tile_surface) != CAIRO_STATUS_SUCCESS) {
-        std::cerr << "[Runtime] Failed to create front tile Cairo surface" << std::endl;
-        delete[] g_world_map;
-        delete[] g_back_world_map;
-        g_world_map = nullptr;
-        g_back_world_map = nullptr;
-        return false;
+    // Composition surfaces are created by the render thread if the Cairo
+    // path is used, so only the maps are set up here
+    int layer_count = g_tile_layer_count;
+    for (int i = 0; i < layer_count; i++) {
+        init_tile_layer_map(g_tile_layers[i]);
     }
     
-    g_tile_cr = cairo_create(g_tile_surface);
-    if (cairo_status(g_tile_cr) != CAIRO_STATUS_SUCCESS) {
-        std::cerr << "[Runtime] Failed to create front tile Cairo context" << std::endl;
-        cairo_surface_destroy(g_tile_surface);
-        g_tile_surface = nullptr;
-        delete[] g_world_map;
-        delete[] g_back_world_map;
-        g_world_map = nullptr;
-        g_back_world_map = nullptr;
-        return false;
-    }
-    
-    // Create Cairo surface for back tile composition
-    g_back_tile_surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, g_tile_view_width, g_tile_view_height);
-    if (cairo_surface_status(g_back_tile_surface) != CAIRO_STATUS_SUCCESS) {
-        std::cerr << "[Runtime] Failed to create back tile Cairo surface" << std::endl;
-        cairo_destroy(g_tile_cr);
-        cairo_surface_destroy(g_tile_surface);
-        g_tile_cr = nullptr;
-        g_tile_surface = nullptr;
-        delete[] g_world_map;
-        delete[] g_back_world_map;
-        g_world_map = nullptr;
-        g_back_world_map = nullptr;
-        return false;
-    }
-    
-    g_back_tile_cr = cairo_create(g_back_tile_surface);
-    if (cairo_status(g_back_tile_cr) != CAIRO_STATUS_SUCCESS) {
-        std::cerr << "[Runtime] Failed to create back tile Cairo context" << std::endl;
-        cairo_surface_destroy(g_back_tile_surface);
-        cairo_destroy(g_tile_cr);
-        cairo_surface_destroy(g_tile_surface);
-        g_back_tile_surface = nullptr;
-        g_tile_cr = nullptr;
-        g_tile_surface = nullptr;
-        delete[] g_world_map;
-        delete[] g_back_world_map;
-        g_world_map = nullptr;
-        g_back_world_map = nullptr;
-        return false;
-    }
-    
-    // Get pointers to Cairo surface data
-    g_tile_bitmap = cairo_image_surface_get_data(g_tile_surface);
-    g_back_tile_bitmap = cairo_image_surface_get_data(g_back_tile_surface);
-    
     g_tiles_initialized = true;
-    std::cout << "[Runtime] Dual tile system initialized successfully" << std::endl;
+    std::cout << "[Runtime] Tile system initialized with " << layer_count << " layers" << std::endl;
     std::cout << "[Runtime] Viewport: " << g_tile_grid_width << "x" << g_tile_grid_height << " tiles" << std::endl;
-    std::cout << "[Runtime] Front layer world map: " << g_world_map_width << "x" << g_world_map_height << " tiles" << std::endl;
-    std::cout << "[Runtime] Back layer world map: " << g_back_world_map_width << "x" << g_back_world_map_height << " tiles" << std::endl;
+    for (int i = 0; i < layer_count; i++) {
+        std::cout << "[Runtime] Layer " << i << " world map: " << g_tile_layers[i].map_width
+                  << "x" << g_tile_layers[i].map_height << " tiles" << std::endl;
+    }
     
     // Final debug check
-    if (g_world_map_width == 0 || g_world_map_height == 0) {
-        std::cerr << "[Runtime] ERROR: World map size is 0! Screen was " << g_screen_width << "x" << g_screen_height << std::endl;
+    if (g_tile_grid_width == 0 || g_tile_grid_height == 0) {
+        std::cerr << "[Runtime] ERROR: Tile grid size is 0! Screen was " << g_screen_width << "x" << g_screen_height << std::endl;
     }
     return true;
 }
@@ -2399,304 +3445,714 @@ bool load_tile(int tile_id, const char* filename) {
     }
     
     g_tile_surfaces[tile_id] = surface;
-    g_tile_dirty = true;  // Mark for rebuild
+    g_tile_atlas_pending[tile_id] = true;  // Copy into the GPU atlas next frame
+    for (TileLayerState& layer : g_tile_layers) {
+        layer.dirty = true;  // Mark for rebuild
+    }
     
     std::cout << "[Runtime] Loaded tile " << tile_id << " from " << filename << std::endl;
     return true;
 }
 
-void set_tile(int world_x, int world_y, int tile_id) {
-    if (!g_tiles_initialized || !g_world_map) {
+// Record an edited rectangle of world tiles for the next frame
+// Edits are coalesced by the render thread; a rectangle too large to track
+// cell by cell marks the whole view for recomposition.
+static void mark_tile_edit(TileEditList& edits, int x, int y, int width, int height) {
+    if (width <= 0 || height <= 0) return;
+
+    std::lock_guard<std::mutex> lock(g_tile_edit_mutex);
+    if (edits.overflow) return;
+
+    if ((size_t)width * height > MAX_TILE_EDITS_PER_FRAME ||
+        edits.cells.size() + (size_t)width * height > MAX_TILE_EDITS_PER_FRAME) {
+        edits.overflow = true;
+        edits.cells.clear();
         return;
     }
-    
-    if (world_x >= 0 && world_x < g_world_map_width && 
-        world_y >= 0 && world_y < g_world_map_height) {
-        g_world_map[world_y * g_world_map_width + world_x] = tile_id;
-        g_tile_dirty = true;  // Mark for rebuild
+
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            edits.cells.push_back(TileEdit(x + col, y + row));
+        }
     }
 }
 
-int get_tile(int world_x, int world_y) {
-    if (!g_tiles_initialized || !g_world_map) {
+// Evict world map chunks far from a layer's view (no-op without a backing file)
+static void evict_distant_tile_chunks(AbstractRuntime::TileMap& map, float viewport_x, float viewport_y) {
+    int center_x = (int)std::floor((viewport_x + 384.0f + g_screen_width / 2) / 128.0f);
+    int center_y = (int)std::floor((viewport_y + 384.0f + g_screen_height / 2) / 128.0f);
+    map.evict_outside(center_x, center_y, g_world_chunk_radius);
+}
+
+void set_tile_palette_entry(int tile_id, int image_id) {
+    if (tile_id <= 0 || tile_id > 255 || image_id < 0 || image_id > 255) {
+        return;
+    }
+    // The render thread redraws only visible cells using this ID
+    std::lock_guard<std::mutex> lock(g_tile_animation_mutex);
+    g_tile_palette[tile_id] = (uint8_t)image_id;
+}
+
+int get_tile_palette_entry(int tile_id) {
+    if (tile_id < 0 || tile_id > 255) {
         return 0;
     }
-    
-    if (world_x >= 0 && world_x < g_world_map_width && 
-        world_y >= 0 && world_y < g_world_map_height) {
-        return g_world_map[world_y * g_world_map_width + world_x];
+    std::lock_guard<std::mutex> lock(g_tile_animation_mutex);
+    return g_tile_palette[tile_id];
+}
+
+void reset_tile_palette() {
+    std::lock_guard<std::mutex> lock(g_tile_animation_mutex);
+    g_tile_palette = identity_tile_palette();
+}
+
+bool define_tile_animation(int tile_id, const int* frames, const int* durations_ms, int frame_count) {
+    if (tile_id <= 0 || tile_id > 255 || !frames || !durations_ms || frame_count <= 0) {
+        std::cerr << "[Runtime] Invalid tile animation for tile " << tile_id << std::endl;
+        return false;
     }
-    return 0;
+
+    TileAnimation animation;
+    uint32_t elapsed = 0;
+    for (int i = 0; i < frame_count; i++) {
+        if (frames[i] < 0 || frames[i] > 255 || durations_ms[i] <= 0) {
+            std::cerr << "[Runtime] Invalid frame " << i << " in tile animation for tile " << tile_id << std::endl;
+            return false;
+        }
+        elapsed += (uint32_t)durations_ms[i];
+        animation.frames.push_back((uint8_t)frames[i]);
+        animation.frame_end.push_back(elapsed);
+    }
+    animation.start_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    std::lock_guard<std::mutex> lock(g_tile_animation_mutex);
+    if (g_tile_animations[tile_id].frames.empty()) {
+        g_tile_animation_count++;
+    }
+    g_tile_animations[tile_id] = animation;
+    return true;
 }
 
-void fill_tiles(int start_x, int start_y, int width, int height, int tile_id) {
-    if (!g_tiles_initialized || !g_world_map) {
+void clear_tile_animation(int tile_id) {
+    if (tile_id <= 0 || tile_id > 255) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_tile_animation_mutex);
+    if (!g_tile_animations[tile_id].frames.empty()) {
+        g_tile_animations[tile_id] = TileAnimation();
+        g_tile_animation_count--;
+    }
+}
+
+void clear_tile_animations() {
+    std::lock_guard<std::mutex> lock(g_tile_animation_mutex);
+    for (TileAnimation& animation : g_tile_animations) {
+        animation = TileAnimation();
+    }
+    g_tile_animation_count = 0;
+}
+
+// Look up a tile layer by index (nullptr when out of range)
+static TileLayerState* get_tile_layer(int layer) {
+    if (layer < 0 || layer >= MAX_TILE_LAYERS) {
+        return nullptr;
+    }
+    return &g_tile_layers[layer];
+}
+
+// Look up a tile layer whose map can be edited
+static TileLayerState* get_editable_tile_layer(int layer) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!g_tiles_initialized || !tiles || !tiles->map.is_allocated()) {
+        return nullptr;
+    }
+    return tiles;
+}
+
+// Apply a map edit and record it for redraw
+static void apply_tile_edit(const StagedTileEdit& edit) {
+    TileLayerState* tiles = get_editable_tile_layer(edit.layer);
+    if (!tiles) {
         return;
     }
     
-    for (int y = start_y; y < start_y + height && y < g_world_map_height; y++) {
-        for (int x = start_x; x < start_x + width && x < g_world_map_width; x++) {
-            if (x >= 0 && y >= 0) {
-                g_world_map[y * g_world_map_width + x] = tile_id;
+    switch (edit.kind) {
+        case StagedTileEdit::SET:
+            if (edit.x >= 0 && edit.x < tiles->map_width && 
+                edit.y >= 0 && edit.y < tiles->map_height) {
+                tiles->map.set(edit.x, edit.y, edit.cell);
+                mark_tile_edit(tiles->edits, edit.x, edit.y, 1, 1);  // Redraw just this cell
             }
-        }
+            break;
+        case StagedTileEdit::FILL:
+            tiles->map.fill(edit.x, edit.y, edit.width, edit.height, edit.cell);
+            mark_tile_edit(tiles->edits, edit.x, edit.y, edit.width, edit.height);
+            break;
+        case StagedTileEdit::CLEAR:
+            tiles->map.clear();
+            tiles->dirty = true;  // Mark for rebuild
+            break;
+        case StagedTileEdit::WRITE:
+            tiles->map.write_rect(edit.x, edit.y, edit.width, edit.height, edit.cells.data());
+            mark_tile_edit(tiles->edits, edit.x, edit.y, edit.width, edit.height);
+            break;
+        case StagedTileEdit::COPY:
+        case StagedTileEdit::MOVE:
+            tiles->map.copy_rect(edit.src_x, edit.src_y, edit.width, edit.height,
+                                 edit.x, edit.y, edit.kind == StagedTileEdit::MOVE);
+            if (edit.kind == StagedTileEdit::MOVE) {
+                mark_tile_edit(tiles->edits, edit.src_x, edit.src_y, edit.width, edit.height);
+            }
+            mark_tile_edit(tiles->edits, edit.x, edit.y, edit.width, edit.height);
+            break;
     }
-    g_tile_dirty = true;  // Mark for rebuild
 }
 
-void clear_tiles() {
-    if (!g_tiles_initialized || !g_world_map) {
+// Apply an edit now, or stage it until the calling thread commits its batch
+static void submit_tile_edit(StagedTileEdit edit) {
+    if (t_tile_edit_depth > 0) {
+        t_staged_tile_edits.push_back(std::move(edit));
         return;
     }
-    
-    memset(g_world_map, 0, g_world_map_width * g_world_map_height * sizeof(int));
-    g_tile_dirty = true;  // Mark for rebuild
+    apply_tile_edit(edit);
 }
 
-void scroll_tiles(float dx, float dy) {
-    if (!g_tiles_initialized) {
+// Publish a layer's view to the renderer, or defer it to the end of the
+// calling thread's batch (caller holds g_tile_view_mutex)
+static void publish_tile_view(int layer) {
+    if (t_tile_edit_depth > 0) {
+        t_tile_views_pending |= 1u << layer;
         return;
     }
+    g_tile_layers[layer].published_view.store(g_tile_layers[layer].view);
+}
+
+void begin_tile_edits() {
+    t_tile_edit_depth++;
+}
+
+void commit_tile_edits() {
+    if (t_tile_edit_depth == 0 || --t_tile_edit_depth > 0) {
+        return;  // Not in a batch, or an inner batch of a nested one
+    }
     
-    g_tile_scroll_x += dx;
-    g_tile_scroll_y += dy;
-    
-    // Update viewport position for world map scrolling
-    g_viewport_x += dx;
-    g_viewport_y += dy;
+    // Land every staged edit and view between two frames
+    std::lock_guard<std::mutex> frame_lock(g_tile_frame_mutex);
+    for (const StagedTileEdit& edit : t_staged_tile_edits) {
+        apply_tile_edit(edit);
+    }
+    t_staged_tile_edits.clear();
     
-    // Handle viewport shifting when exceeding ±128 pixels, maintaining visual continuity
-    bool viewport_shifted = false;
+    std::lock_guard<std::mutex> view_lock(g_tile_view_mutex);
+    for (int i = 0; i < MAX_TILE_LAYERS; i++) {
+        if (t_tile_views_pending & (1u << i)) {
+            publish_tile_view(i);
+        }
+    }
+    t_tile_views_pending = 0;
+}
+
+void set_layer_tile(int layer, int world_x, int world_y, int tile_id) {
+    submit_tile_edit(StagedTileEdit{ StagedTileEdit::SET, layer, world_x, world_y, 1, 1, tile_id });
+}
+
+int get_layer_tile(int layer, int world_x, int world_y) {
+    TileLayerState* tiles = get_editable_tile_layer(layer);
+    if (!tiles) {
+        return 0;
+    }
     
-    // Handle horizontal viewport shifting (3 tile border = ±384 pixels)
-    if (g_tile_scroll_x > 384.0f) {
-        g_tile_scroll_x -= 384.0f;
-        viewport_shifted = true;
-    } else if (g_tile_scroll_x < -384.0f) {
-        g_tile_scroll_x += 384.0f;
-        viewport_shifted = true;
+    if (world_x >= 0 && world_x < tiles->map_width && 
+        world_y >= 0 && world_y < tiles->map_height) {
+        return tiles->map.get(world_x, world_y);
+    }
+    return 0;
+}
+
+void fill_layer_tiles(int layer, int start_x, int start_y, int width, int height, int tile_id) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    submit_tile_edit(StagedTileEdit{ StagedTileEdit::FILL, layer, start_x, start_y, width, height, tile_id });
+}
+
+void clear_layer_tiles(int layer) {
+    submit_tile_edit(StagedTileEdit{ StagedTileEdit::CLEAR, layer });
+}
+
+void write_layer_tiles(int layer, int start_x, int start_y, int width, int height, const uint16_t* cells) {
+    if (!cells || width <= 0 || height <= 0) {
+        return;
     }
     
-    // Handle vertical viewport shifting (3 tile border = ±384 pixels)
-    if (g_tile_scroll_y > 384.0f) {
-        g_tile_scroll_y -= 384.0f;
-        viewport_shifted = true;
-    } else if (g_tile_scroll_y < -384.0f) {
-        g_tile_scroll_y += 384.0f;
-        viewport_shifted = true;
+    // The data is copied so the caller's buffer can be reused at once, even
+    // when the write is staged in a batch
+    StagedTileEdit edit{ StagedTileEdit::WRITE, layer, start_x, start_y, width, height };
+    edit.cells.assign(cells, cells + (size_t)width * height);
+    submit_tile_edit(std::move(edit));
+}
+
+void read_layer_tiles(int layer, int start_x, int start_y, int width, int height, uint16_t* cells) {
+    if (!cells || width <= 0 || height <= 0) {
+        return;
     }
     
-    // If viewport shifted, mark tiles for regeneration
-    if (viewport_shifted) {
-        g_tile_dirty = true;
+    TileLayerState* tiles = get_editable_tile_layer(layer);
+    if (!tiles) {
+        std::fill(cells, cells + (size_t)width * height, 0);
+        return;
     }
+    tiles->map.read_rect(start_x, start_y, width, height, cells);
 }
 
-void set_tile_scroll(float x, float y) {
-    if (!g_tiles_initialized) {
+void copy_layer_tiles(int layer, int src_x, int src_y, int width, int height, int dest_x, int dest_y) {
+    if (width <= 0 || height <= 0) {
         return;
     }
-    
+    StagedTileEdit edit{ StagedTileEdit::COPY, layer, dest_x, dest_y, width, height };
+    edit.src_x = src_x;
+    edit.src_y = src_y;
+    submit_tile_edit(std::move(edit));
+}
+
+void move_layer_tiles(int layer, int src_x, int src_y, int width, int height, int dest_x, int dest_y) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    StagedTileEdit edit{ StagedTileEdit::MOVE, layer, dest_x, dest_y, width, height };
+    edit.src_x = src_x;
+    edit.src_y = src_y;
+    submit_tile_edit(std::move(edit));
+}
+
+// Move a layer's viewport to an absolute position (caller holds
+// g_tile_view_mutex). Returns true when the viewport entered a new tile.
+static bool set_tile_view_position(TileViewState& view, float x, float y) {
     // Store previous viewport tile position
-    int old_tile_x = (int)(g_viewport_x / 128.0f);
-    int old_tile_y = (int)(g_viewport_y / 128.0f);
+    int old_tile_x = (int)(view.viewport_x / 128.0f);
+    int old_tile_y = (int)(view.viewport_y / 128.0f);
     
     // Set absolute viewport position
-    g_viewport_x = x;
-    g_viewport_y = y;
+    view.viewport_x = x;
+    view.viewport_y = y;
     
     // Calculate which tile the viewport should be centered on
-    int new_tile_x = (int)(g_viewport_x / 128.0f);
-    int new_tile_y = (int)(g_viewport_y / 128.0f);
+    int new_tile_x = (int)(view.viewport_x / 128.0f);
+    int new_tile_y = (int)(view.viewport_y / 128.0f);
     
     // Calculate sub-tile offset within the current tile
-    g_tile_scroll_x = g_viewport_x - (new_tile_x * 128.0f);
-    g_tile_scroll_y = g_viewport_y - (new_tile_y * 128.0f);
+    view.scroll_x = view.viewport_x - (new_tile_x * 128.0f);
+    view.scroll_y = view.viewport_y - (new_tile_y * 128.0f);
+    view.window_x = new_tile_x;
+    view.window_y = new_tile_y;
     
-    // Check if viewport has shifted to a different tile
-    if (old_tile_x != new_tile_x || old_tile_y != new_tile_y) {
-        g_tile_dirty = true;  // Viewport shifted, regenerate texture
-    }
+    return old_tile_x != new_tile_x || old_tile_y != new_tile_y;
 }
 
-bool set_world_map_size(int width, int height) {
-    if (g_tiles_initialized) {
-        std::cerr << "[Runtime] Cannot set world map size after tiles are initialized" << std::endl;
-        return false;
+void scroll_layer_tiles(int layer, float dx, float dy) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!g_tiles_initialized || !tiles) {
+        return;
     }
     
-    if (width <= 0 || height <= 0) {
-        std::cerr << "[Runtime] Invalid world map size: " << width << "x" << height << std::endl;
-        return false;
+    bool viewport_shifted = false;
+    float viewport_x, viewport_y;
+    {
+        std::lock_guard<std::mutex> lock(g_tile_view_mutex);
+        TileViewState& view = tiles->view;
+        
+        view.scroll_x += dx;
+        view.scroll_y += dy;
+        
+        // Update viewport position for world map scrolling
+        view.viewport_x += dx;
+        view.viewport_y += dy;
+        
+        // Handle horizontal viewport shifting (3 tile border = ±384 pixels)
+        if (view.scroll_x > 384.0f) {
+            view.scroll_x -= 384.0f;
+            view.window_x += 3;
+            viewport_shifted = true;
+        } else if (view.scroll_x < -384.0f) {
+            view.scroll_x += 384.0f;
+            view.window_x -= 3;
+            viewport_shifted = true;
+        }
+        
+        // Handle vertical viewport shifting (3 tile border = ±384 pixels)
+        if (view.scroll_y > 384.0f) {
+            view.scroll_y -= 384.0f;
+            view.window_y += 3;
+            viewport_shifted = true;
+        } else if (view.scroll_y < -384.0f) {
+            view.scroll_y += 384.0f;
+            view.window_y -= 3;
+            viewport_shifted = true;
+        }
+        
+        publish_tile_view(layer);
+        viewport_x = view.viewport_x;
+        viewport_y = view.viewport_y;
     }
     
-    // Clean up existing world map if any
-    if (g_world_map) {
-        delete[] g_world_map;
-        g_world_map = nullptr;
+    // The renderer composes the newly exposed strips of the new window
+    if (viewport_shifted) {
+        evict_distant_tile_chunks(tiles->map, viewport_x, viewport_y);
     }
-    
-    g_world_map_width = width;
-    g_world_map_height = height;
-    
-    std::cout << "[Runtime] World map size set to " << width << "x" << height << " tiles" << std::endl;
-    return true;
 }
 
-void get_world_map_size(int* width, int* height) {
-    if (!width || !height) {
+void set_layer_tile_scroll(int layer, float x, float y) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!g_tiles_initialized || !tiles) {
         return;
     }
     
-    *width = g_world_map_width;
-    *height = g_world_map_height;
+    bool viewport_shifted;
+    {
+        std::lock_guard<std::mutex> lock(g_tile_view_mutex);
+        viewport_shifted = set_tile_view_position(tiles->view, x, y);
+        publish_tile_view(layer);
+    }
+    
+    if (viewport_shifted) {
+        evict_distant_tile_chunks(tiles->map, x, y);
+    }
 }
 
-void get_tile_grid_size(int* width, int* height) {
-    if (!g_tiles_initialized || !width || !height) {
-        if (width) *width = 0;
-        if (height) *height = 0;
+void get_layer_tile_scroll(int layer, float* x, float* y) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!tiles || !x || !y) {
         return;
     }
     
-    *width = g_tile_grid_width;  // Viewport size, not world map size
-    *height = g_tile_grid_height;
+    std::lock_guard<std::mutex> lock(g_tile_view_mutex);
+    *x = tiles->view.viewport_x;
+    *y = tiles->view.viewport_y;
 }
 
-// =============================================================================
-// BACK TILE LAYER API (LAYER_TILES2) - Parallax Support
-// =============================================================================
-
-void set_back_tile(int world_x, int world_y, int tile_id) {
-    if (!g_tiles_initialized || !g_back_world_map) {
-        return;
+bool set_tile_layer_count(int count) {
+    if (count < 1 || count > MAX_TILE_LAYERS) {
+        std::cerr << "[Runtime] Invalid tile layer count: " << count << std::endl;
+        return false;
     }
     
-    if (world_x >= 0 && world_x < g_back_world_map_width && 
-        world_y >= 0 && world_y < g_back_world_map_height) {
-        g_back_world_map[world_y * g_back_world_map_width + world_x] = tile_id;
-        g_back_tile_dirty = true;  // Mark for rebuild
+    // Layers that become drawn need a map
+    if (g_tiles_initialized) {
+        for (int i = g_tile_layer_count; i < count; i++) {
+            init_tile_layer_map(g_tile_layers[i]);
+        }
     }
+    g_tile_layer_count = count;
+    return true;
 }
 
-int get_back_tile(int world_x, int world_y) {
-    if (!g_tiles_initialized || !g_back_world_map) {
-        return 0;
+int get_tile_layer_count() {
+    return g_tile_layer_count;
+}
+
+bool set_tile_layer_map_size(int layer, int width, int height) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!tiles || width <= 0 || height <= 0) {
+        std::cerr << "[Runtime] Invalid map size for tile layer " << layer << ": "
+                  << width << "x" << height << std::endl;
+        return false;
     }
     
-    if (world_x >= 0 && world_x < g_back_world_map_width && 
-        world_y >= 0 && world_y < g_back_world_map_height) {
-        return g_back_world_map[world_y * g_back_world_map_width + world_x];
+    // Drop the current contents; after init_tiles() the map is reallocated now
+    std::lock_guard<std::mutex> frame_lock(g_tile_frame_mutex);
+    tiles->map_width = width;
+    tiles->map_height = height;
+    if (g_tiles_initialized) {
+        tiles->map.reset(width, height);
+        {
+            std::lock_guard<std::mutex> lock(g_tile_edit_mutex);
+            tiles->edits.cells.clear();
+        }
+        tiles->dirty = true;
+    } else {
+        tiles->map.reset(0, 0);
     }
-    return 0;
+    return true;
 }
 
-void fill_back_tiles(int start_x, int start_y, int width, int height, int tile_id) {
-    if (!g_tiles_initialized || !g_back_world_map) {
+void get_tile_layer_map_size(int layer, int* width, int* height) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!tiles || !width || !height) {
         return;
     }
     
-    for (int y = start_y; y < start_y + height && y < g_back_world_map_height; y++) {
-        for (int x = start_x; x < start_x + width && x < g_back_world_map_width; x++) {
-            if (x >= 0 && y >= 0) {
-                g_back_world_map[y * g_back_world_map_width + x] = tile_id;
-            }
-        }
-    }
-    g_back_tile_dirty = true;  // Mark for rebuild
+    *width = tiles->map_width;
+    *height = tiles->map_height;
 }
 
-void clear_back_tiles() {
-    if (!g_tiles_initialized || !g_back_world_map) {
+void set_tile_layer_parallax(int layer, float factor_x, float factor_y) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!tiles) {
         return;
     }
     
-    memset(g_back_world_map, 0, g_back_world_map_width * g_back_world_map_height * sizeof(int));
-    g_back_tile_dirty = true;  // Mark for rebuild
+    std::lock_guard<std::mutex> lock(g_tile_view_mutex);
+    tiles->parallax_x = factor_x;
+    tiles->parallax_y = factor_y;
 }
 
-void scroll_back_tiles(float dx, float dy) {
-    if (!g_tiles_initialized) {
+void set_tile_layer_visible(int layer, bool visible) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!tiles) {
         return;
     }
     
-    g_back_tile_scroll_x += dx;
-    g_back_tile_scroll_y += dy;
-    
-    // Update viewport position for world map scrolling
-    g_back_viewport_x += dx;
-    g_back_viewport_y += dy;
-    
-    // Handle viewport shifting when exceeding ±128 pixels, maintaining visual continuity
-    bool viewport_shifted = false;
-    
-    // Handle horizontal viewport shifting (3 tile border = ±384 pixels)
-    if (g_back_tile_scroll_x > 384.0f) {
-        g_back_tile_scroll_x -= 384.0f;
-        viewport_shifted = true;
-    } else if (g_back_tile_scroll_x < -384.0f) {
-        g_back_tile_scroll_x += 384.0f;
-        viewport_shifted = true;
+    tiles->visible = visible;
+}
+
+bool is_tile_layer_visible(int layer) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    return tiles && tiles->visible;
+}
+
+bool set_tile_layer_backing_file(int layer, const char* path) {
+    TileLayerState* tiles = get_tile_layer(layer);
+    if (!tiles) {
+        return false;
+    }
+    return tiles->map.set_backing_file(path);
+}
+
+void set_tile_camera(float x, float y) {
+    if (!g_tiles_initialized) {
+        return;
     }
     
-    // Handle vertical viewport shifting (3 tile border = ±384 pixels)
-    if (g_back_tile_scroll_y > 384.0f) {
-        g_back_tile_scroll_y -= 384.0f;
-        viewport_shifted = true;
-    } else if (g_back_tile_scroll_y < -384.0f) {
-        g_back_tile_scroll_y += 384.0f;
-        viewport_shifted = true;
+    // Each layer follows the camera scaled by its parallax factor; all
+    // layers are published under one lock so they move in the same frame
+    bool shifted[MAX_TILE_LAYERS] = {};
+    TileViewState views[MAX_TILE_LAYERS];
+    int layer_count = g_tile_layer_count;
+    {
+        std::lock_guard<std::mutex> lock(g_tile_view_mutex);
+        g_tile_camera_x = x;
+        g_tile_camera_y = y;
+        for (int i = 0; i < layer_count; i++) {
+            TileLayerState& layer = g_tile_layers[i];
+            shifted[i] = set_tile_view_position(layer.view, x * layer.parallax_x, y * layer.parallax_y);
+            publish_tile_view(i);
+            views[i] = layer.view;
+        }
     }
     
-    // If viewport shifted, mark tiles for regeneration
-    if (viewport_shifted) {
-        g_back_tile_dirty = true;
+    for (int i = 0; i < layer_count; i++) {
+        if (shifted[i]) {
+            evict_distant_tile_chunks(g_tile_layers[i].map, views[i].viewport_x, views[i].viewport_y);
+        }
     }
 }
 
-void set_back_tile_scroll(float x, float y) {
-    if (!g_tiles_initialized) {
+void scroll_tile_camera(float dx, float dy) {
+    float x, y;
+    get_tile_camera(&x, &y);
+    set_tile_camera(x + dx, y + dy);
+}
+
+void get_tile_camera(float* x, float* y) {
+    if (!x || !y) {
         return;
     }
     
-    // Store previous viewport tile position
-    int old_tile_x = (int)(g_back_viewport_x / 128.0f);
-    int old_tile_y = (int)(g_back_viewport_y / 128.0f);
-    
-    // Set absolute viewport position
-    g_back_viewport_x = x;
-    g_back_viewport_y = y;
+    std::lock_guard<std::mutex> lock(g_tile_view_mutex);
+    *x = g_tile_camera_x;
+    *y = g_tile_camera_y;
+}
+
+bool set_world_map_size(int width, int height) {
+    if (g_tiles_initialized) {
+        std::cerr << "[Runtime] Cannot set world map size after tiles are initialized" << std::endl;
+        return false;
+    }
     
-    // Calculate which tile the viewport should be centered on
-    int new_tile_x = (int)(g_back_viewport_x / 128.0f);
-    int new_tile_y = (int)(g_back_viewport_y / 128.0f);
+    if (!set_tile_layer_map_size(TILE_LAYER_FRONT, width, height)) {
+        return false;
+    }
     
-    // Calculate sub-tile offset within the current tile
-    g_back_tile_scroll_x = g_back_viewport_x - (new_tile_x * 128.0f);
-    g_back_tile_scroll_y = g_back_viewport_y - (new_tile_y * 128.0f);
+    std::cout << "[Runtime] World map size set to " << width << "x" << height << " tiles" << std::endl;
+    return true;
+}
+
+void get_world_map_size(int* width, int* height) {
+    get_tile_layer_map_size(TILE_LAYER_FRONT, width, height);
+}
+
+bool load_world_map_file(const char* path) {
+    AbstractRuntime::TileMap* maps[MAX_TILE_LAYERS];
+    for (int i = 0; i < MAX_TILE_LAYERS; i++) {
+        maps[i] = &g_tile_layers[i].map;
+    }
     
-    // Check if viewport has shifted to a different tile
-    if (old_tile_x != new_tile_x || old_tile_y != new_tile_y) {
-        g_back_tile_dirty = true;  // Viewport shifted, regenerate texture
+    // The maps are swapped between frames
+    int layer_count = 0;
+    {
+        std::lock_guard<std::mutex> frame_lock(g_tile_frame_mutex);
+        if (!AbstractRuntime::load_tile_map_file(path, maps, MAX_TILE_LAYERS, &layer_count)) {
+            return false;
+        }
+        
+        // Layers missing from the file are emptied; they take the front
+        // layer's size if they are drawn again
+        for (int i = 0; i < MAX_TILE_LAYERS; i++) {
+            TileLayerState& layer = g_tile_layers[i];
+            if (i >= layer_count) {
+                layer.map.release();
+            }
+            layer.map_width = layer.map.get_width();
+            layer.map_height = layer.map.get_height();
+            layer.dirty = true;
+        }
+        
+        // Pending cell edits refer to the old maps
+        std::lock_guard<std::mutex> lock(g_tile_edit_mutex);
+        for (TileLayerState& layer : g_tile_layers) {
+            layer.edits.cells.clear();
+        }
     }
+    set_tile_layer_count(layer_count);
+    return true;
 }
 
-void get_back_tile_scroll(float* x, float* y) {
-    if (!x || !y) {
+bool save_world_map_file(const char* path, bool compress) {
+    const AbstractRuntime::TileMap* maps[MAX_TILE_LAYERS];
+    int layer_count = g_tile_layer_count;
+    for (int i = 0; i < layer_count; i++) {
+        maps[i] = &g_tile_layers[i].map;
+    }
+    return AbstractRuntime::save_tile_map_file(path, maps, layer_count, compress);
+}
+
+bool set_world_map_backing_file(const char* path) {
+    return set_tile_layer_backing_file(TILE_LAYER_FRONT, path);
+}
+
+bool set_back_world_map_backing_file(const char* path) {
+    return set_tile_layer_backing_file(TILE_LAYER_BACK, path);
+}
+
+void set_world_map_residency_radius(int chunks) {
+    // The visible window always fits within one chunk of the centre
+    g_world_chunk_radius = std::max(1, chunks);
+}
+
+void get_world_map_chunk_stats(int* resident, int* evicted) {
+    int resident_total = 0;
+    int evicted_total = 0;
+    for (const TileLayerState& layer : g_tile_layers) {
+        resident_total += layer.map.get_resident_chunk_count();
+        evicted_total += layer.map.get_evicted_chunk_count();
+    }
+    if (resident) {
+        *resident = resident_total;
+    }
+    if (evicted) {
+        *evicted = evicted_total;
+    }
+}
+
+void set_tile_gpu_rendering(bool enable) {
+    g_tile_gpu_requested = enable;
+}
+
+bool is_tile_gpu_rendering() {
+    return g_tile_gpu_active;
+}
+
+void get_tile_grid_size(int* width, int* height) {
+    if (!g_tiles_initialized || !width || !height) {
+        if (width) *width = 0;
+        if (height) *height = 0;
         return;
     }
     
-    *x = g_back_viewport_x;
-    *y = g_back_viewport_y;
+    *width = g_tile_grid_width;  // Viewport size, not world map size
+    *height = g_tile_grid_height;
+}
+
+// =============================================================================
+// FRONT TILE LAYER (LAYER_TILES1) - Original API
+// =============================================================================
+
+void set_tile(int world_x, int world_y, int tile_id) {
+    set_layer_tile(TILE_LAYER_FRONT, world_x, world_y, tile_id);
+}
+
+int get_tile(int world_x, int world_y) {
+    return get_layer_tile(TILE_LAYER_FRONT, world_x, world_y);
+}
+
+void fill_tiles(int start_x, int start_y, int width, int height, int tile_id) {
+    fill_layer_tiles(TILE_LAYER_FRONT, start_x, start_y, width, height, tile_id);
+}
+
+void clear_tiles() {
+    clear_layer_tiles(TILE_LAYER_FRONT);
+}
+
+void write_tiles(int start_x, int start_y, int width, int height, const uint16_t* cells) {
+    write_layer_tiles(TILE_LAYER_FRONT, start_x, start_y, width, height, cells);
+}
+
+void read_tiles(int start_x, int start_y, int width, int height, uint16_t* cells) {
+    read_layer_tiles(TILE_LAYER_FRONT, start_x, start_y, width, height, cells);
+}
+
+void copy_tiles(int src_x, int src_y, int width, int height, int dest_x, int dest_y) {
+    copy_layer_tiles(TILE_LAYER_FRONT, src_x, src_y, width, height, dest_x, dest_y);
+}
+
+void move_tiles(int src_x, int src_y, int width, int height, int dest_x, int dest_y) {
+    move_layer_tiles(TILE_LAYER_FRONT, src_x, src_y, width, height, dest_x, dest_y);
+}
+
+void scroll_tiles(float dx, float dy) {
+    scroll_layer_tiles(TILE_LAYER_FRONT, dx, dy);
+}
+
+void set_tile_scroll(float x, float y) {
+    set_layer_tile_scroll(TILE_LAYER_FRONT, x, y);
 }
 
 void get_tile_scroll(float* x, float* y) {
-    if (!x || !y) {
-        return;
-    }
+    get_layer_tile_scroll(TILE_LAYER_FRONT, x, y);
+}
 
-    *x = g_viewport_x;
-    *y = g_viewport_y;
+// =============================================================================
+// BACK TILE LAYER API (LAYER_TILES2) - Parallax Support
+// =============================================================================
+
+void set_back_tile(int world_x, int world_y, int tile_id) {
+    set_layer_tile(TILE_LAYER_BACK, world_x, world_y, tile_id);
+}
+
+int get_back_tile(int world_x, int world_y) {
+    return get_layer_tile(TILE_LAYER_BACK, world_x, world_y);
+}
+
+void fill_back_tiles(int start_x, int start_y, int width, int height, int tile_id) {
+    fill_layer_tiles(TILE_LAYER_BACK, start_x, start_y, width, height, tile_id);
+}
+
+void clear_back_tiles() {
+    clear_layer_tiles(TILE_LAYER_BACK);
+}
+
+void scroll_back_tiles(float dx, float dy) {
+    scroll_layer_tiles(TILE_LAYER_BACK, dx, dy);
+}
+
+void set_back_tile_scroll(float x, float y) {
+    set_layer_tile_scroll(TILE_LAYER_BACK, x, y);
+}
+
+void get_back_tile_scroll(float* x, float* y) {
+    get_layer_tile_scroll(TILE_LAYER_BACK, x, y);
 }
 
 // =============================================================================
@@ -357,10 +357,9 @@ void CompositorThread::render_graphics_layer(const AbstractRuntime::Layer& layer
 
 void CompositorThread::render_sprite_layer(const AbstractRuntime::Layer& layer) {
     // Get current sprite positions (lock-free read)
-    AbstractRuntime::SpriteInstance visible_sprites[MAX_SPRITES];
-    int sprite_count = 0;
+    visible_sprites_.clear();
     
-    for (int i = 0; i < MAX_SPRITES; ++i) {
+    for (int i = 0; i < AbstractRuntime::RuntimeState::MAX_SPRITES; ++i) {
         AbstractRuntime::SpritePosition pos = runtime_state_->sprite_positions[i].load(std::memory_order_acquire);
         if (pos.visible) {
             // Transform to screen coordinates
@@ -371,7 +370,7 @@ void CompositorThread::render_sprite_layer(const AbstractRuntime::Layer& layer)
             if (screen_x > -SPRITE_SIZE && screen_x < screen_width_ + SPRITE_SIZE &&
                 screen_y > -SPRITE_SIZE && screen_y < screen_height_ + SPRITE_SIZE) {
                 
-                visible_sprites[sprite_count] = {
+                visible_sprites_.push_back({
                     .active = true,
                     .sprite_slot = pos.sprite_slot,
                     .x = (float)screen_x,
@@ -381,15 +380,14 @@ void CompositorThread::render_sprite_layer(const AbstractRuntime::Layer& layer)
                     .rotation = pos.rotation,
                     .alpha = pos.alpha,
                     .z_order = 0
-                };
-                sprite_count++;
+                });
             }
         }
     }
     
     // Render visible sprites
     layer_renderer_->render_sprites(
-        visible_sprites, sprite_count, *runtime_state_->sprite_bank
+        visible_sprites_.data(), (int)visible_sprites_.size(), *runtime_state_->sprite_bank
     );
 }
 
@@ -1,7 +1,7 @@
 #include "font_atlas.h"
 #include <ft2build.h>
 #include FT_FREETYPE_H
-#include <OpenGL/gl3.h>
+#include <OpenGL/gl.h>
 #include <iostream>
 #include <cstring>
 #include <algorithm>
@@ -20,9 +20,11 @@ const FontAtlas::CharacterRange FontAtlas::standard_ranges_[] = {
 const FontAtlas::CharacterRange FontAtlas::extended_ranges_[] = {
     {128, 128, "Extended ASCII"},     // Extended ASCII
     {0x2500, 128, "Box Drawing"},     // Box drawing characters
+    {0x2580, 32, "Block Elements"},   // Half blocks and shades used by PETSCII
     {0x2190, 32, "Arrows"},           // Arrow symbols
     {0x2200, 64, "Math Symbols"},     // Mathematical symbols
     {0x25A0, 32, "Geometric"},        // Geometric shapes
+    {0x1FB00, 256, "Legacy Computing"}, // PETSCII graphics mapped to Unicode
     {0, 0, nullptr}                   // Sentinel
 };
 
@@ -39,7 +41,9 @@ FontAtlas::FontAtlas()
     , is_monospace_(true)
     , pack_x_(0)
     , pack_y_(0)
-    , pack_row_height_(0) {
+    , pack_row_height_(0)
+    , solid_u_(0.0f)
+    , solid_v_(0.0f) {
 }
 
 FontAtlas::~FontAtlas() {
@@ -69,6 +73,13 @@ bool FontAtlas::initialize(const FontConfig& config) {
     pack_x_ = 1;  // Leave 1 pixel border
     pack_y_ = 1;
     pack_row_height_ = 0;
+    missing_characters_.clear();
+    
+    // Solid block first so background quads can share the atlas texture
+    if (!reserve_solid_block()) {
+        std::cerr << "Failed to reserve solid block in font atlas" << std::endl;
+        return false;
+    }
     
     // Load standard ASCII characters
     if (!load_ascii_characters()) {
@@ -81,6 +92,10 @@ bool FontAtlas::initialize(const FontConfig& config) {
         load_extended_ascii();
     }
     
+    if (config.include_petscii) {
+        load_petscii_characters();
+    }
+    
     if (config.include_unicode_blocks) {
         load_unicode_blocks();
     }
@@ -109,6 +124,7 @@ void FontAtlas::shutdown() {
     
     cleanup_freetype();
     characters_.clear();
+    missing_characters_.clear();
     atlas_buffer_.clear();
 }
 
@@ -123,6 +139,34 @@ const CharacterMetrics* FontAtlas::get_character(uint32_t codepoint) const {
     return (fallback != characters_.end()) ? &fallback->second : nullptr;
 }
 
+const CharacterMetrics* FontAtlas::get_or_load_character(uint32_t codepoint) {
+    auto it = characters_.find(codepoint);
+    if (it != characters_.end()) {
+        return &it->second;
+    }
+    
+    // Only ask FreeType once per codepoint the font does not have
+    if (!ft_face_ || missing_characters_.count(codepoint)) {
+        return nullptr;
+    }
+    
+    if (!render_character(codepoint)) {
+        missing_characters_.insert(codepoint);
+        return nullptr;
+    }
+    
+    const CharacterMetrics& metrics = characters_[codepoint];
+    
+    // Atlas already lives on the GPU: push just the new glyph
+    if (atlas_texture_) {
+        int x = static_cast<int>(metrics.tex_x * atlas_width_ + 0.5f);
+        int y = static_cast<int>(metrics.tex_y * atlas_height_ + 0.5f);
+        upload_atlas_region(x, y, metrics.width + 2, metrics.height + 2);
+    }
+    
+    return &metrics;
+}
+
 void FontAtlas::measure_text(const char* text, int& width, int& height) const {
     width = 0;
     height = line_height_;
@@ -189,7 +233,7 @@ bool FontAtlas::render_character(uint32_t codepoint) {
     }
     
     // Copy glyph to atlas (with 1 pixel border)
-    copy_glyph_to_atlas(bitmap.buffer, bitmap.width, bitmap.rows, 
+    copy_glyph_to_atlas(bitmap.buffer, bitmap.width, bitmap.rows, bitmap.pitch,
                        atlas_x + 1, atlas_y + 1);
     
     // Calculate texture coordinates
@@ -235,20 +279,49 @@ bool FontAtlas::pack_character(int width, int height, int& out_x, int& out_y) {
 }
 
 void FontAtlas::copy_glyph_to_atlas(const uint8_t* glyph_buffer,
-                                   int glyph_width, int glyph_height,
+                                   int glyph_width, int glyph_height, int glyph_pitch,
                                    int atlas_x, int atlas_y) {
     for (int y = 0; y < glyph_height; ++y) {
         for (int x = 0; x < glyph_width; ++x) {
             int atlas_idx = (atlas_y + y) * atlas_width_ + (atlas_x + x);
-            int glyph_idx = y * glyph_width + x;
+            int glyph_idx = y * glyph_pitch + x;  // FreeType rows may be padded
             
-            if (atlas_idx < atlas_buffer_.size() && glyph_idx < glyph_width * glyph_height) {
+            if (atlas_idx < atlas_buffer_.size()) {
                 atlas_buffer_[atlas_idx] = glyph_buffer[glyph_idx];
             }
         }
     }
 }
 
+bool FontAtlas::reserve_solid_block() {
+    // 4x4 opaque block; sampling its centre never touches neighbouring glyphs
+    const int block_size = 4;
+    int block_x, block_y;
+    if (!pack_character(block_size + 2, block_size + 2, block_x, block_y)) {
+        return false;
+    }
+    
+    for (int y = 0; y < block_size; ++y) {
+        for (int x = 0; x < block_size; ++x) {
+            atlas_buffer_[(block_y + 1 + y) * atlas_width_ + (block_x + 1 + x)] = 255;
+        }
+    }
+    
+    solid_u_ = (block_x + 1 + block_size * 0.5f) / atlas_width_;
+    solid_v_ = (block_y + 1 + block_size * 0.5f) / atlas_height_;
+    return true;
+}
+
+void FontAtlas::upload_atlas_region(int x, int y, int width, int height) {
+    glBindTexture(GL_TEXTURE_2D, atlas_texture_);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas_width_);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height,
+                    GL_ALPHA, GL_UNSIGNED_BYTE, &atlas_buffer_[y * atlas_width_ + x]);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
 bool FontAtlas::upload_atlas_texture() {
     // Generate OpenGL texture
     glGenTextures(1, &atlas_texture_);
@@ -0,0 +1,96 @@
+#include "glyph_cache.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <cstring>
+
+namespace AbstractRuntime {
+
+GlyphCache::GlyphCache()
+    : face_(nullptr)
+    , hits_(0)
+    , misses_(0)
+    , cached_count_(0) {
+}
+
+GlyphCache::~GlyphCache() {
+    clear();
+}
+
+void GlyphCache::set_face(FT_Face face) {
+    clear();
+    face_ = face;
+}
+
+void GlyphCache::clear() {
+    for (int i = 0; i < FLAT_RANGE_SIZE; i++) {
+        latin1_[i] = CachedGlyph();
+        box_[i] = CachedGlyph();
+        petscii_[i] = CachedGlyph();
+        legacy_[i] = CachedGlyph();
+    }
+    other_.clear();
+    cached_count_.store(0, std::memory_order_relaxed);
+}
+
+void GlyphCache::reset_stats() {
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+}
+
+CachedGlyph& GlyphCache::slot_for(uint32_t codepoint) {
+    if (codepoint - LATIN1_START < FLAT_RANGE_SIZE) {
+        return latin1_[codepoint - LATIN1_START];
+    }
+    if (codepoint - BOX_START < FLAT_RANGE_SIZE) {
+        return box_[codepoint - BOX_START];
+    }
+    if (codepoint - PETSCII_START < FLAT_RANGE_SIZE) {
+        return petscii_[codepoint - PETSCII_START];
+    }
+    if (codepoint - LEGACY_START < FLAT_RANGE_SIZE) {
+        return legacy_[codepoint - LEGACY_START];
+    }
+    return other_[codepoint];
+}
+
+const CachedGlyph* GlyphCache::get_glyph(uint32_t codepoint) {
+    CachedGlyph& glyph = slot_for(codepoint);
+
+    if (glyph.loaded) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        rasterize(codepoint, glyph);
+    }
+
+    return glyph.valid ? &glyph : nullptr;
+}
+
+void GlyphCache::rasterize(uint32_t codepoint, CachedGlyph& glyph) {
+    glyph.loaded = true;
+    glyph.valid = false;
+    cached_count_.fetch_add(1, std::memory_order_relaxed);
+
+    if (!face_ || FT_Load_Char(face_, codepoint, FT_LOAD_RENDER) != 0) {
+        return;
+    }
+
+    FT_GlyphSlot slot = face_->glyph;
+    const FT_Bitmap& bitmap = slot->bitmap;
+
+    glyph.width = (int)bitmap.width;
+    glyph.rows = (int)bitmap.rows;
+    glyph.left = slot->bitmap_left;
+    glyph.top = slot->bitmap_top;
+    glyph.coverage.assign((size_t)glyph.width * glyph.rows, 0);
+
+    // Copy row by row so the cached bitmap is tightly packed regardless of pitch
+    for (int gy = 0; gy < glyph.rows; gy++) {
+        const unsigned char* src = bitmap.buffer + gy * bitmap.pitch;
+        memcpy(&glyph.coverage[(size_t)gy * glyph.width], src, glyph.width);
+    }
+
+    glyph.valid = true;
+}
+
+} // namespace AbstractRuntime
@@ -5,10 +5,13 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <climits>
 #include <cstdlib>
 #include <cstring>
 #include <chrono>
 #include <filesystem>
+#include <vector>
+#include <algorithm>
 
 // =============================================================================
 // LUAJIT THREAD MANAGER IMPLEMENTATION
@@ -420,6 +423,24 @@ int lua_get_screen_height(lua_State* L) {
     return 1;
 }
 
+int lua_set_text_grid_size(lua_State* L) {
+    int columns = luaL_checkinteger(L, 1);
+    int rows = luaL_checkinteger(L, 2);
+    
+    bool result;
+    RUNTIME_API_CALL(result = set_text_grid_size(columns, rows));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_get_text_grid_size(lua_State* L) {
+    int columns, rows;
+    RUNTIME_API_CALL(get_text_grid_size(&columns, &rows));
+    lua_pushinteger(L, columns);
+    lua_pushinteger(L, rows);
+    return 2;
+}
+
 // =============================================================================
 // LUA BINDING FUNCTIONS - TEXT SYSTEM
 // =============================================================================
@@ -443,10 +464,70 @@ int lua_clear_text(lua_State* L) {
 
 int lua_scroll_text(lua_State* L) {
     int lines = luaL_checkinteger(L, 1);
-    RUNTIME_API_CALL(scroll_text(0, lines));
+    RUNTIME_API_CALL(scroll_text_lines(lines));
+    return 0;
+}
+
+int lua_scroll_text_pixels(lua_State* L) {
+    int dx = luaL_checkinteger(L, 1);
+    int dy = luaL_checkinteger(L, 2);
+    RUNTIME_API_CALL(scroll_text(dx, dy));
+    return 0;
+}
+
+int lua_append_text_line(lua_State* L) {
+    const char* text = luaL_optstring(L, 1, "");
+    RUNTIME_API_CALL(append_text_line(text));
+    return 0;
+}
+
+int lua_set_text_scrollback_size(lua_State* L) {
+    int lines = luaL_checkinteger(L, 1);
+    bool result;
+    RUNTIME_API_CALL(result = set_text_scrollback_size(lines));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_get_text_scrollback_count(lua_State* L) {
+    int count;
+    RUNTIME_API_CALL(count = get_text_scrollback_count());
+    lua_pushinteger(L, count);
+    return 1;
+}
+
+int lua_set_text_scrollback_view(lua_State* L) {
+    int lines_back = luaL_checkinteger(L, 1);
+    RUNTIME_API_CALL(set_text_scrollback_view(lines_back));
+    return 0;
+}
+
+int lua_get_text_scrollback_view(lua_State* L) {
+    int view;
+    RUNTIME_API_CALL(view = get_text_scrollback_view());
+    lua_pushinteger(L, view);
+    return 1;
+}
+
+int lua_page_text_scrollback(lua_State* L) {
+    int pages = luaL_checkinteger(L, 1);
+    RUNTIME_API_CALL(page_text_scrollback(pages));
     return 0;
 }
 
+int lua_clear_text_scrollback(lua_State* L) {
+    RUNTIME_API_CALL(clear_text_scrollback());
+    return 0;
+}
+
+int lua_get_text_scroll_offset(lua_State* L) {
+    int dx, dy;
+    RUNTIME_API_CALL(get_text_scroll_offset(&dx, &dy));
+    lua_pushinteger(L, dx);
+    lua_pushinteger(L, dy);
+    return 2;
+}
+
 int lua_scroll_text_up(lua_State* L) {
     RUNTIME_API_CALL(scroll_text_up());
     return 0;
@@ -602,6 +683,234 @@ int lua_wait_for_render_complete(lua_State* L) {
     return 0;
 }
 
+// Read a packed 0xRRGGBBAA color from the Lua stack
+static uint32_t lua_to_packed_color(lua_State* L, int index) {
+    return (uint32_t)(int64_t)lua_tonumber(L, index);
+}
+
+// Read a cell character: a number is a codepoint, a string uses its first byte
+static bool lua_to_text_char(lua_State* L, int index, uint32_t* codepoint) {
+    if (lua_type(L, index) == LUA_TNUMBER) {
+        *codepoint = (uint32_t)lua_tointeger(L, index);
+        return true;
+    }
+    if (lua_type(L, index) == LUA_TSTRING) {
+        const char* str = lua_tostring(L, index);
+        if (!str[0]) return false;
+        *codepoint = (unsigned char)str[0];
+        return true;
+    }
+    return false;
+}
+
+// Part of a row-major rectangle passed from Lua that lies inside a grid.
+// Buffers are sized from the window, never from the requested rectangle.
+struct LuaCellWindow {
+    int dest_x;             // Grid position of the window
+    int dest_y;
+    int width;              // Window size in cells
+    int height;
+    int source_x;           // Window position in the source rectangle
+    int source_y;
+    int source_width;       // Requested rectangle
+    size_t source_cells;
+
+    size_t cells() const { return (size_t)width * height; }
+
+    // Source cell of window cell i
+    size_t source_index(size_t i) const {
+        return (size_t)(source_y + (int)(i / width)) * source_width + source_x + (int)(i % width);
+    }
+};
+
+// Clip a requested rectangle to a grid_width x grid_height grid
+static bool clip_lua_cell_window(int x, int y, int width, int height, int grid_width, int grid_height,
+                                 LuaCellWindow& window) {
+    if (width <= 0 || height <= 0) return false;
+
+    long long x0 = std::max<long long>(x, 0);
+    long long y0 = std::max<long long>(y, 0);
+    long long x1 = std::min<long long>((long long)x + width, grid_width);
+    long long y1 = std::min<long long>((long long)y + height, grid_height);
+    if (x1 <= x0 || y1 <= y0) return false;
+
+    window.dest_x = (int)x0;
+    window.dest_y = (int)y0;
+    window.width = (int)(x1 - x0);
+    window.height = (int)(y1 - y0);
+    window.source_x = (int)(x0 - x);
+    window.source_y = (int)(y0 - y);
+    window.source_width = width;
+    window.source_cells = (size_t)width * height;
+    return true;
+}
+
+// Fill a per-cell plane from nil (unused), a number (uniform) or a table
+static bool lua_to_text_plane(lua_State* L, int index, const LuaCellWindow& window, bool is_color,
+                              std::vector<uint32_t>& plane) {
+    if (lua_isnoneornil(L, index)) return false;
+
+    plane.assign(window.cells(), 0);
+    if (lua_type(L, index) == LUA_TNUMBER) {
+        uint32_t value = is_color ? lua_to_packed_color(L, index) : (uint32_t)lua_tointeger(L, index);
+        std::fill(plane.begin(), plane.end(), value);
+    } else if (lua_type(L, index) == LUA_TSTRING) {
+        // One cell per byte, like print_at; cells past the end keep their character
+        size_t len = 0;
+        const char* str = lua_tolstring(L, index, &len);
+        for (size_t i = 0; i < plane.size(); i++) {
+            size_t source = window.source_index(i);
+            if (source < len) plane[i] = (unsigned char)str[source];
+        }
+    } else if (lua_istable(L, index)) {
+        for (size_t i = 0; i < plane.size(); i++) {
+            size_t source = window.source_index(i);
+            if (source >= (size_t)INT_MAX) continue;
+            lua_rawgeti(L, index, (int)source + 1);
+            if (is_color) {
+                if (lua_isnumber(L, -1)) plane[i] = lua_to_packed_color(L, -1);
+            } else {
+                lua_to_text_char(L, -1, &plane[i]);
+            }
+            lua_pop(L, 1);
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int lua_pack_rgba(lua_State* L) {
+    int r = luaL_checkinteger(L, 1);
+    int g = luaL_checkinteger(L, 2);
+    int b = luaL_checkinteger(L, 3);
+    int a = luaL_optinteger(L, 4, 255);
+    
+    int ret = validate_color(L, r, g, b, a, "pack_rgba");
+    if (ret) return ret;
+    
+    uint32_t packed = ((uint32_t)r << 24) | ((uint32_t)g << 16) | ((uint32_t)b << 8) | (uint32_t)a;
+    lua_pushnumber(L, (lua_Number)packed);
+    return 1;
+}
+
+int lua_write_text_cells(lua_State* L) {
+    luaL_checktype(L, 1, LUA_TTABLE);
+    
+    // Build the whole batch before taking the runtime lock
+    int count = (int)lua_objlen(L, 1);
+    std::vector<TextCellWrite> cells;
+    cells.reserve(count);
+    
+    for (int i = 1; i <= count; i++) {
+        lua_rawgeti(L, 1, i);
+        if (lua_istable(L, -1)) {
+            int entry = lua_gettop(L);
+            TextCellWrite cell = {};
+            
+            lua_rawgeti(L, entry, 1);
+            lua_rawgeti(L, entry, 2);
+            cell.x = (int)lua_tointeger(L, -2);
+            cell.y = (int)lua_tointeger(L, -1);
+            lua_pop(L, 2);
+            
+            lua_rawgeti(L, entry, 3);
+            if (lua_to_text_char(L, -1, &cell.codepoint)) cell.mask |= TEXT_WRITE_CHAR;
+            lua_pop(L, 1);
+            
+            lua_rawgeti(L, entry, 4);
+            if (lua_isnumber(L, -1)) {
+                cell.ink = lua_to_packed_color(L, -1);
+                cell.mask |= TEXT_WRITE_INK;
+            }
+            lua_pop(L, 1);
+            
+            lua_rawgeti(L, entry, 5);
+            if (lua_isnumber(L, -1)) {
+                cell.paper = lua_to_packed_color(L, -1);
+                cell.mask |= TEXT_WRITE_PAPER;
+            }
+            lua_pop(L, 1);
+            
+            if (cell.mask) cells.push_back(cell);
+        }
+        lua_pop(L, 1);
+    }
+    
+    int written = 0;
+    if (!cells.empty()) {
+        RUNTIME_API_CALL(written = write_text_cells(cells.data(), (int)cells.size()));
+    }
+    lua_pushinteger(L, written);
+    return 1;
+}
+
+int lua_write_text_block(lua_State* L) {
+    int x = luaL_checkinteger(L, 1);
+    int y = luaL_checkinteger(L, 2);
+    int width = luaL_checkinteger(L, 3);
+    int height = luaL_checkinteger(L, 4);
+    
+    // Only the part of the block on the grid is converted
+    int columns = 0, rows = 0;
+    get_text_grid_size(&columns, &rows);
+    LuaCellWindow window;
+    if (!clip_lua_cell_window(x, y, width, height, columns, rows, window)) return 0;
+    
+    std::vector<uint32_t> codepoints, ink, paper;
+    bool has_chars = lua_to_text_plane(L, 5, window, false, codepoints);
+    bool has_ink = lua_to_text_plane(L, 6, window, true, ink);
+    bool has_paper = lua_to_text_plane(L, 7, window, true, paper);
+    
+    RUNTIME_API_CALL(write_text_block(window.dest_x, window.dest_y, window.width, window.height,
+                                      has_chars ? codepoints.data() : nullptr,
+                                      has_ink ? ink.data() : nullptr,
+                                      has_paper ? paper.data() : nullptr));
+    return 0;
+}
+
+int lua_get_glyph_cache_stats(lua_State* L) {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    int cached = 0;
+    get_glyph_cache_stats(&hits, &misses, &cached);
+    
+    // Return as Lua table
+    lua_newtable(L);
+    
+    lua_pushstring(L, "hits");
+    lua_pushnumber(L, (lua_Number)hits);
+    lua_settable(L, -3);
+    
+    lua_pushstring(L, "misses");
+    lua_pushnumber(L, (lua_Number)misses);
+    lua_settable(L, -3);
+    
+    lua_pushstring(L, "cached_glyphs");
+    lua_pushinteger(L, cached);
+    lua_settable(L, -3);
+    
+    return 1;
+}
+
+int lua_reset_glyph_cache_stats(lua_State* L) {
+    reset_glyph_cache_stats();
+    return 0;
+}
+
+int lua_set_text_gpu_rendering(lua_State* L) {
+    bool enable = lua_toboolean(L, 1);
+    RUNTIME_API_CALL(set_text_gpu_rendering(enable));
+    return 0;
+}
+
+int lua_is_text_gpu_rendering(lua_State* L) {
+    bool enabled;
+    RUNTIME_API_CALL(enabled = is_text_gpu_rendering());
+    lua_pushboolean(L, enabled);
+    return 1;
+}
+
 // =============================================================================
 // LUA BINDING FUNCTIONS - INPUT SYSTEM
 // =============================================================================
@@ -724,8 +1033,10 @@ int lua_set_draw_color(lua_State* L) {
 // =============================================================================
 
 int lua_init_sprites(lua_State* L) {
-    RUNTIME_API_CALL(init_sprites());
-    return 0;
+    bool result;
+    RUNTIME_API_CALL(result = init_sprites());
+    lua_pushboolean(L, result);
+    return 1;
 }
 
 int lua_load_sprite(lua_State* L) {
@@ -747,6 +1058,144 @@ int lua_sprite(lua_State* L) {
     return 0;
 }
 
+int lua_sprite_create(lua_State* L) {
+    int slot = luaL_checkinteger(L, 1);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+    
+    int id;
+    RUNTIME_API_CALL(id = sprite_create(slot, x, y));
+    if (id >= 0) {
+        lua_pushinteger(L, id);
+    } else {
+        lua_pushnil(L);
+    }
+    return 1;
+}
+
+int lua_sprite_destroy(lua_State* L) {
+    int id = luaL_checkinteger(L, 1);
+    
+    bool result;
+    RUNTIME_API_CALL(result = sprite_destroy(id));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_sprite_move(lua_State* L) {
+    int id = luaL_checkinteger(L, 1);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+    
+    bool result;
+    RUNTIME_API_CALL(result = sprite_move(id, x, y));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_sprite_scale(lua_State* L) {
+    int id = luaL_checkinteger(L, 1);
+    float scale_x = (float)luaL_checknumber(L, 2);
+    float scale_y = (float)luaL_optnumber(L, 3, scale_x);
+    
+    bool result;
+    RUNTIME_API_CALL(result = sprite_scale(id, scale_x, scale_y));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_sprite_rotate(lua_State* L) {
+    int id = luaL_checkinteger(L, 1);
+    float degrees = (float)luaL_checknumber(L, 2);
+    
+    bool result;
+    RUNTIME_API_CALL(result = sprite_rotate(id, degrees));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_sprite_alpha(lua_State* L) {
+    int id = luaL_checkinteger(L, 1);
+    float alpha = (float)luaL_checknumber(L, 2);
+    
+    bool result;
+    RUNTIME_API_CALL(result = sprite_alpha(id, alpha));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_begin_sprite_updates(lua_State* L) {
+    RUNTIME_API_CALL(begin_sprite_updates());
+    return 0;
+}
+
+int lua_commit_sprite_updates(lua_State* L) {
+    RUNTIME_API_CALL(commit_sprite_updates());
+    return 0;
+}
+
+int lua_get_sprite_publish_count(lua_State* L) {
+    unsigned int count;
+    RUNTIME_API_CALL(count = get_sprite_publish_count());
+    lua_pushinteger(L, count);
+    return 1;
+}
+
+// Fields per sprite in a flat sprite_update_many table
+static const int SPRITE_UPDATE_FIELDS = 6;
+
+// Usage:
+//   sprite_update_many({ id, x, y, rotation, scale, alpha, id, x, ... })
+//   sprite_update_many(packed_string)          -- SpriteTransform records
+// SpriteTransform is { int32_t id; float x, y, rotation, scale, alpha; }.
+// FFI buffers go through ffi.C.sprite_update_transforms(array, count)
+// instead, so the FFI checks the argument types.
+// Returns the number of sprites updated.
+int lua_sprite_update_many(lua_State* L) {
+    std::vector<SpriteTransform> transforms;
+    const SpriteTransform* data = nullptr;
+    int count = 0;
+    
+    if (lua_istable(L, 1)) {
+        // Build the whole batch before taking the runtime lock
+        count = (int)lua_objlen(L, 1) / SPRITE_UPDATE_FIELDS;
+        transforms.resize(count);
+        for (int i = 0; i < count; i++) {
+            int base = i * SPRITE_UPDATE_FIELDS;
+            for (int field = 1; field <= SPRITE_UPDATE_FIELDS; field++) {
+                lua_rawgeti(L, 1, base + field);
+            }
+            transforms[i].id = (int32_t)lua_tointeger(L, -6);
+            transforms[i].x = (float)lua_tonumber(L, -5);
+            transforms[i].y = (float)lua_tonumber(L, -4);
+            transforms[i].rotation = (float)lua_tonumber(L, -3);
+            transforms[i].scale = (float)lua_tonumber(L, -2);
+            transforms[i].alpha = (float)lua_tonumber(L, -1);
+            lua_pop(L, SPRITE_UPDATE_FIELDS);
+        }
+        data = transforms.data();
+    } else if (lua_type(L, 1) == LUA_TSTRING) {
+        // Copy out so the records are aligned
+        size_t len = 0;
+        const char* bytes = lua_tolstring(L, 1, &len);
+        count = (int)(len / sizeof(SpriteTransform));
+        transforms.resize(count);
+        if (count > 0) {
+            memcpy(transforms.data(), bytes, count * sizeof(SpriteTransform));
+        }
+        data = transforms.data();
+    } else {
+        return luaL_argerror(L, 1, "table or string expected");
+    }
+    
+    int updated = 0;
+    if (data && count > 0) {
+        RUNTIME_API_CALL(updated = sprite_update_transforms(data, count));
+    }
+    lua_pushinteger(L, updated);
+    return 1;
+}
+
 // Sprite Allocator Functions
 int lua_allocate_sprite(lua_State* L) {
     // Get current thread ID (use Lua thread pointer as unique identifier)
@@ -911,6 +1360,189 @@ int lua_console_separator(lua_State* L) {
     return 0;
 }
 
+// =============================================================================
+// LUA BINDING FUNCTIONS - TILES
+// =============================================================================
+
+int lua_init_tiles(lua_State* L) {
+    bool result;
+    RUNTIME_API_CALL(result = init_tiles());
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_set_world_map_size(lua_State* L) {
+    int width = luaL_checkinteger(L, 1);
+    int height = luaL_checkinteger(L, 2);
+    
+    bool result;
+    RUNTIME_API_CALL(result = set_world_map_size(width, height));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_load_tile(lua_State* L) {
+    int id = luaL_checkinteger(L, 1);
+    const char* filename = luaL_checkstring(L, 2);
+    
+    bool result;
+    RUNTIME_API_CALL(result = load_tile(id, filename));
+    lua_pushboolean(L, result);
+    return 1;
+}
+
+int lua_set_tile(lua_State* L) {
+    int x = luaL_checkinteger(L, 1);
+    int y = luaL_checkinteger(L, 2);
+    int cell = luaL_checkinteger(L, 3);
+    int layer = luaL_optinteger(L, 4, TILE_LAYER_FRONT);
+    
+    RUNTIME_API_CALL(set_layer_tile(layer, x, y, cell));
+    return 0;
+}
+
+int lua_get_tile(lua_State* L) {
+    int x = luaL_checkinteger(L, 1);
+    int y = luaL_checkinteger(L, 2);
+    int layer = luaL_optinteger(L, 3, TILE_LAYER_FRONT);
+    
+    int result;
+    RUNTIME_API_CALL(result = get_layer_tile(layer, x, y));
+    lua_pushinteger(L, result);
+    return 1;
+}
+
+int lua_begin_tile_edits(lua_State* L) {
+    RUNTIME_API_CALL(begin_tile_edits());
+    return 0;
+}
+
+int lua_commit_tile_edits(lua_State* L) {
+    RUNTIME_API_CALL(commit_tile_edits());
+    return 0;
+}
+
+// Fill a cell rectangle from a flat table of cells or a string buffer.
+// A string of 2 * count bytes holds little-endian 16-bit cells (ID plus
+// flags); a shorter one holds one tile ID per byte.
+static bool lua_to_tile_cells(lua_State* L, int index, const LuaCellWindow& window,
+                              std::vector<uint16_t>& cells) {
+    cells.assign(window.cells(), 0);
+    if (lua_type(L, index) == LUA_TSTRING) {
+        size_t len = 0;
+        const unsigned char* bytes = (const unsigned char*)lua_tolstring(L, index, &len);
+        bool wide = len >= window.source_cells * 2;
+        for (size_t i = 0; i < cells.size(); i++) {
+            size_t source = window.source_index(i);
+            if (wide) {
+                cells[i] = (uint16_t)(bytes[source * 2] | (bytes[source * 2 + 1] << 8));
+            } else if (source < len) {
+                cells[i] = bytes[source];
+            }
+        }
+    } else if (lua_istable(L, index)) {
+        for (size_t i = 0; i < cells.size(); i++) {
+            size_t source = window.source_index(i);
+            if (source >= (size_t)INT_MAX) continue;
+            lua_rawgeti(L, index, (int)source + 1);
+            if (lua_isnumber(L, -1)) cells[i] = (uint16_t)lua_tointeger(L, -1);
+            lua_pop(L, 1);
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int lua_write_tiles(lua_State* L) {
+    int x = luaL_checkinteger(L, 1);
+    int y = luaL_checkinteger(L, 2);
+    int width = luaL_checkinteger(L, 3);
+    int height = luaL_checkinteger(L, 4);
+    int layer = luaL_optinteger(L, 6, TILE_LAYER_FRONT);
+    
+    if (!lua_istable(L, 5) && lua_type(L, 5) != LUA_TSTRING) {
+        return luaL_argerror(L, 5, "table or string expected");
+    }
+    
+    // Only the part of the rectangle on the map is converted
+    int map_width = 0, map_height = 0;
+    get_tile_layer_map_size(layer, &map_width, &map_height);
+    LuaCellWindow window;
+    if (!clip_lua_cell_window(x, y, width, height, map_width, map_height, window)) return 0;
+    
+    std::vector<uint16_t> cells;
+    lua_to_tile_cells(L, 5, window, cells);
+    
+    RUNTIME_API_CALL(write_layer_tiles(layer, window.dest_x, window.dest_y,
+                                       window.width, window.height, cells.data()));
+    return 0;
+}
+
+int lua_read_tiles(lua_State* L) {
+    int x = luaL_checkinteger(L, 1);
+    int y = luaL_checkinteger(L, 2);
+    int width = luaL_checkinteger(L, 3);
+    int height = luaL_checkinteger(L, 4);
+    int layer = luaL_optinteger(L, 5, TILE_LAYER_FRONT);
+    bool as_string = lua_toboolean(L, 6);
+    
+    // Reads are limited to the map size (cells off the map still read as 0)
+    int map_width = 0, map_height = 0;
+    get_tile_layer_map_size(layer, &map_width, &map_height);
+    width = std::min(width, map_width);
+    height = std::min(height, map_height);
+    
+    size_t count = (width > 0 && height > 0) ? (size_t)width * height : 0;
+    std::vector<uint16_t> cells(count);
+    if (count > 0) {
+        RUNTIME_API_CALL(read_layer_tiles(layer, x, y, width, height, cells.data()));
+    }
+    
+    if (as_string) {
+        // Little-endian 16-bit cells, the same layout write_tiles accepts
+        std::string buffer(count * 2, '\0');
+        for (size_t i = 0; i < count; i++) {
+            buffer[i * 2] = (char)(cells[i] & 0xFF);
+            buffer[i * 2 + 1] = (char)(cells[i] >> 8);
+        }
+        lua_pushlstring(L, buffer.data(), buffer.size());
+    } else {
+        lua_createtable(L, (int)count, 0);
+        for (size_t i = 0; i < count; i++) {
+            lua_pushinteger(L, cells[i]);
+            lua_rawseti(L, -2, (int)i + 1);
+        }
+    }
+    return 1;
+}
+
+int lua_copy_tiles(lua_State* L) {
+    int src_x = luaL_checkinteger(L, 1);
+    int src_y = luaL_checkinteger(L, 2);
+    int width = luaL_checkinteger(L, 3);
+    int height = luaL_checkinteger(L, 4);
+    int dest_x = luaL_checkinteger(L, 5);
+    int dest_y = luaL_checkinteger(L, 6);
+    int layer = luaL_optinteger(L, 7, TILE_LAYER_FRONT);
+    
+    RUNTIME_API_CALL(copy_layer_tiles(layer, src_x, src_y, width, height, dest_x, dest_y));
+    return 0;
+}
+
+int lua_move_tiles(lua_State* L) {
+    int src_x = luaL_checkinteger(L, 1);
+    int src_y = luaL_checkinteger(L, 2);
+    int width = luaL_checkinteger(L, 3);
+    int height = luaL_checkinteger(L, 4);
+    int dest_x = luaL_checkinteger(L, 5);
+    int dest_y = luaL_checkinteger(L, 6);
+    int layer = luaL_optinteger(L, 7, TILE_LAYER_FRONT);
+    
+    RUNTIME_API_CALL(move_layer_tiles(layer, src_x, src_y, width, height, dest_x, dest_y));
+    return 0;
+}
+
 // =============================================================================
 // LUA BINDING FUNCTIONS - THREADING
 // =============================================================================
@@ -990,12 +1622,23 @@ void register_display_functions(lua_State* L) {
     lua_register(L, "set_background_color", lua_set_background_color);
     lua_register(L, "get_screen_width", lua_get_screen_width);
     lua_register(L, "get_screen_height", lua_get_screen_height);
+    lua_register(L, "set_text_grid_size", lua_set_text_grid_size);
+    lua_register(L, "get_text_grid_size", lua_get_text_grid_size);
 }
 
 void register_text_functions(lua_State* L) {
     lua_register(L, "print_at", lua_print_at);
     lua_register(L, "clear_text", lua_clear_text);
     lua_register(L, "scroll_text", lua_scroll_text);
+    lua_register(L, "scroll_text_pixels", lua_scroll_text_pixels);
+    lua_register(L, "get_text_scroll_offset", lua_get_text_scroll_offset);
+    lua_register(L, "append_text_line", lua_append_text_line);
+    lua_register(L, "set_text_scrollback_size", lua_set_text_scrollback_size);
+    lua_register(L, "get_text_scrollback_count", lua_get_text_scrollback_count);
+    lua_register(L, "set_text_scrollback_view", lua_set_text_scrollback_view);
+    lua_register(L, "get_text_scrollback_view", lua_get_text_scrollback_view);
+    lua_register(L, "page_text_scrollback", lua_page_text_scrollback);
+    lua_register(L, "clear_text_scrollback", lua_clear_text_scrollback);
     lua_register(L, "scroll_text_up", lua_scroll_text_up);
     lua_register(L, "scroll_text_down", lua_scroll_text_down);
     lua_register(L, "set_text_ink", lua_set_text_ink);
@@ -1011,6 +1654,13 @@ void register_text_functions(lua_State* L) {
     lua_register(L, "get_saved_text_count", lua_get_saved_text_count);
     lua_register(L, "clear_saved_text", lua_clear_saved_text);
     lua_register(L, "wait_for_render_complete", lua_wait_for_render_complete);
+    lua_register(L, "pack_rgba", lua_pack_rgba);
+    lua_register(L, "write_text_cells", lua_write_text_cells);
+    lua_register(L, "write_text_block", lua_write_text_block);
+    lua_register(L, "get_glyph_cache_stats", lua_get_glyph_cache_stats);
+    lua_register(L, "reset_glyph_cache_stats", lua_reset_glyph_cache_stats);
+    lua_register(L, "set_text_gpu_rendering", lua_set_text_gpu_rendering);
+    lua_register(L, "is_text_gpu_rendering", lua_is_text_gpu_rendering);
 }
 
 void register_cursor_functions(lua_State* L) {
@@ -1040,6 +1690,28 @@ void register_sprite_functions(lua_State* L) {
     lua_register(L, "init_sprites", lua_init_sprites);
     lua_register(L, "load_sprite", lua_load_sprite);
     lua_register(L, "sprite", lua_sprite);
+    lua_register(L, "sprite_create", lua_sprite_create);
+    lua_register(L, "sprite_destroy", lua_sprite_destroy);
+    lua_register(L, "sprite_move", lua_sprite_move);
+    lua_register(L, "sprite_scale", lua_sprite_scale);
+    lua_register(L, "sprite_rotate", lua_sprite_rotate);
+    lua_register(L, "sprite_alpha", lua_sprite_alpha);
+    lua_register(L, "sprite_update_many", lua_sprite_update_many);
+    lua_register(L, "begin_sprite_updates", lua_begin_sprite_updates);
+    lua_register(L, "commit_sprite_updates", lua_commit_sprite_updates);
+    lua_register(L, "get_sprite_publish_count", lua_get_sprite_publish_count);
+    
+    // Declare SpriteTransform and sprite_update_transforms for the FFI
+    // (ignored if this state already declared them)
+    if (luaL_dostring(L,
+            "pcall(function() require('ffi').cdef[[\n"
+            "typedef struct SpriteTransform {\n"
+            "    int32_t id; float x, y, rotation, scale, alpha;\n"
+            "} SpriteTransform;\n"
+            "int sprite_update_transforms(const SpriteTransform* transforms, int count);\n"
+            "]] end)") != 0) {
+        lua_pop(L, 1);
+    }
     
     // Sprite allocation functions
     lua_register(L, "allocate_sprite", lua_allocate_sprite);
@@ -1063,7 +1735,17 @@ void register_console_functions(lua_State* L) {
 }
 
 void register_tile_functions(lua_State* L) {
-    // Tile functions would go here when needed
+    lua_register(L, "set_world_map_size", lua_set_world_map_size);
+    lua_register(L, "init_tiles", lua_init_tiles);
+    lua_register(L, "load_tile", lua_load_tile);
+    lua_register(L, "set_tile", lua_set_tile);
+    lua_register(L, "get_tile", lua_get_tile);
+    lua_register(L, "begin_tile_edits", lua_begin_tile_edits);
+    lua_register(L, "commit_tile_edits", lua_commit_tile_edits);
+    lua_register(L, "write_tiles", lua_write_tiles);
+    lua_register(L, "read_tiles", lua_read_tiles);
+    lua_register(L, "copy_tiles", lua_copy_tiles);
+    lua_register(L, "move_tiles", lua_move_tiles);
 }
 
 void register_threading_functions(lua_State* L) {
@@ -1087,6 +1769,17 @@ void register_runtime_constants(lua_State* L) {
     // Screen modes
     lua_pushinteger(L, 0); lua_setglobal(L, "SCREEN_MODE_WINDOW");
     lua_pushinteger(L, 1); lua_setglobal(L, "SCREEN_MODE_FULLSCREEN");
+    
+    // Text grid screen modes
+    lua_pushinteger(L, SCREEN_20_COLUMN); lua_setglobal(L, "SCREEN_20_COLUMN");
+    lua_pushinteger(L, SCREEN_40_COLUMN); lua_setglobal(L, "SCREEN_40_COLUMN");
+    lua_pushinteger(L, SCREEN_80_COLUMN); lua_setglobal(L, "SCREEN_80_COLUMN");
+    lua_pushinteger(L, SCREEN_132_COLUMN); lua_setglobal(L, "SCREEN_132_COLUMN");
+    lua_pushinteger(L, SCREEN_200_COLUMN); lua_setglobal(L, "SCREEN_200_COLUMN");
+    
+    // Tile layers
+    lua_pushinteger(L, TILE_LAYER_BACK); lua_setglobal(L, "TILE_LAYER_BACK");
+    lua_pushinteger(L, TILE_LAYER_FRONT); lua_setglobal(L, "TILE_LAYER_FRONT");
 }
 
 void lua_mark_runtime_initialized() {
@@ -10,61 +10,55 @@ SpriteAllocator& SpriteAllocator::getInstance() {
     return instance;
 }
 
-void SpriteAllocator::initializeAvailableSprites() {
-    if (initialized_) return;
+SpriteAllocator::SpriteID SpriteAllocator::takeFreeSprite() {
+    // Prefer released IDs, skipping any claimed by allocateSpecificSprite since
+    while (!free_ids_.empty()) {
+        SpriteID sprite_id = free_ids_.back();
+        free_ids_.pop_back();
+        if (sprite_owners_.find(sprite_id) == sprite_owners_.end()) {
+            return sprite_id;
+        }
+    }
     
-    for (SpriteID id = MIN_SPRITE_ID; id <= MAX_SPRITE_ID; ++id) {
-        available_sprites_.insert(id);
+    while (next_unused_id_ <= MAX_SPRITE_ID) {
+        SpriteID sprite_id = next_unused_id_++;
+        if (sprite_owners_.find(sprite_id) == sprite_owners_.end()) {
+            return sprite_id;
+        }
     }
-    initialized_ = true;
+    
+    return INVALID_SPRITE_ID;
+}
+
+void SpriteAllocator::recordOwner(SpriteID sprite_id, ThreadID thread_id) {
+    sprite_owners_[sprite_id] = thread_id;
+    thread_sprites_[thread_id].insert(sprite_id);
 }
 
 SpriteAllocator::SpriteID SpriteAllocator::allocateSprite(ThreadID thread_id) {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    if (!initialized_) {
-        initializeAvailableSprites();
-    }
-    
-    if (available_sprites_.empty()) {
-        return INVALID_SPRITE_ID;
+    SpriteID sprite_id = takeFreeSprite();
+    if (sprite_id != INVALID_SPRITE_ID) {
+        recordOwner(sprite_id, thread_id);
     }
     
-    // Get the first available sprite
-    SpriteID sprite_id = *available_sprites_.begin();
-    
-    // Remove from available set
-    available_sprites_.erase(sprite_id);
-    
-    // Record ownership
-    sprite_owners_[sprite_id] = thread_id;
-    thread_sprites_[thread_id].insert(sprite_id);
-    
     return sprite_id;
 }
 
 std::vector<SpriteAllocator::SpriteID> SpriteAllocator::allocateSprites(ThreadID thread_id, uint32_t count) {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    if (!initialized_) {
-        initializeAvailableSprites();
-    }
-    
     std::vector<SpriteID> allocated;
-    allocated.reserve(std::min(count, static_cast<uint32_t>(available_sprites_.size())));
+    allocated.reserve(std::min<size_t>(count, MAX_SPRITE_ID - MIN_SPRITE_ID + 1 - sprite_owners_.size()));
     
-    auto it = available_sprites_.begin();
-    while (it != available_sprites_.end() && allocated.size() < count) {
-        SpriteID sprite_id = *it;
-        
-        // Record ownership
-        sprite_owners_[sprite_id] = thread_id;
-        thread_sprites_[thread_id].insert(sprite_id);
+    while (allocated.size() < count) {
+        SpriteID sprite_id = takeFreeSprite();
+        if (sprite_id == INVALID_SPRITE_ID) {
+            break;
+        }
+        recordOwner(sprite_id, thread_id);
         allocated.push_back(sprite_id);
-        
-        // Remove from available (iterator becomes invalid, so we restart)
-        available_sprites_.erase(it);
-        it = available_sprites_.begin();
     }
     
     return allocated;
@@ -73,26 +67,18 @@ std::vector<SpriteAllocator::SpriteID> SpriteAllocator::allocateSprites(ThreadID
 bool SpriteAllocator::allocateSpecificSprite(ThreadID thread_id, SpriteID sprite_id) {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    if (!initialized_) {
-        initializeAvailableSprites();
-    }
-    
     // Check if sprite ID is valid
     if (sprite_id < MIN_SPRITE_ID || sprite_id > MAX_SPRITE_ID) {
         return false;
     }
     
     // Check if sprite is available
-    if (available_sprites_.find(sprite_id) == available_sprites_.end()) {
+    if (sprite_owners_.find(sprite_id) != sprite_owners_.end()) {
         return false; // Already allocated
     }
     
-    // Remove from available set
-    available_sprites_.erase(sprite_id);
-    
     // Record ownership
-    sprite_owners_[sprite_id] = thread_id;
-    thread_sprites_[thread_id].insert(sprite_id);
+    recordOwner(sprite_id, thread_id);
     
     return true;
 }
@@ -118,7 +104,7 @@ bool SpriteAllocator::releaseSprite(SpriteID sprite_id, ThreadID thread_id) {
     }
     
     // Return to available pool
-    available_sprites_.insert(sprite_id);
+    free_ids_.push_back(sprite_id);
     
     return true;
 }
@@ -137,7 +123,7 @@ uint32_t SpriteAllocator::releaseAllSprites(ThreadID thread_id) {
         sprite_owners_.erase(sprite_id);
         
         // Return to available pool
-        available_sprites_.insert(sprite_id);
+        free_ids_.push_back(sprite_id);
         
         ++released_count;
     }
@@ -162,7 +148,7 @@ bool SpriteAllocator::isSpriteAvailable(SpriteID sprite_id) const {
         return false;
     }
     
-    return available_sprites_.find(sprite_id) != available_sprites_.end();
+    return sprite_owners_.find(sprite_id) == sprite_owners_.end();
 }
 
 SpriteAllocator::ThreadID SpriteAllocator::getSpriteOwner(SpriteID sprite_id) const {
@@ -185,7 +171,7 @@ std::vector<SpriteAllocator::SpriteID> SpriteAllocator::getSpritesOwnedBy(Thread
 
 uint32_t SpriteAllocator::getAvailableCount() const {
     std::lock_guard<std::mutex> lock(mutex_);
-    return static_cast<uint32_t>(available_sprites_.size());
+    return MAX_SPRITE_ID - MIN_SPRITE_ID + 1 - static_cast<uint32_t>(sprite_owners_.size());
 }
 
 uint32_t SpriteAllocator::getAllocatedCount() const {
@@ -198,12 +184,8 @@ void SpriteAllocator::reset() {
     
     sprite_owners_.clear();
     thread_sprites_.clear();
-    available_sprites_.clear();
-    
-    // Reinitialize
-    for (SpriteID id = MIN_SPRITE_ID; id <= MAX_SPRITE_ID; ++id) {
-        available_sprites_.insert(id);
-    }
+    free_ids_.clear();
+    next_unused_id_ = MIN_SPRITE_ID;
 }
 
 SpriteAllocator::Stats SpriteAllocator::getStats() const {
@@ -212,7 +194,7 @@ SpriteAllocator::Stats SpriteAllocator::getStats() const {
     Stats stats;
     stats.total_sprites = MAX_SPRITE_ID - MIN_SPRITE_ID + 1;
     stats.allocated_sprites = static_cast<uint32_t>(sprite_owners_.size());
-    stats.available_sprites = static_cast<uint32_t>(available_sprites_.size());
+    stats.available_sprites = stats.total_sprites - stats.allocated_sprites;
     stats.active_threads = static_cast<uint32_t>(thread_sprites_.size());
     
     return stats;
@@ -8,12 +8,6 @@
 
 namespace AbstractRuntime {
 
-SpriteSlot::~SpriteSlot() {
-    if (texture_id != 0) {
-        glDeleteTextures(1, &texture_id);
-    }
-}
-
 SpriteBank::SpriteBank()
     : initialized_(false)
     , sprite_count_(0) {
@@ -51,13 +45,16 @@ void SpriteBank::shutdown() {
     
     std::lock_guard<std::mutex> lock(bank_mutex_);
     
-    // Release all textures
+    // Release all atlas pages (the slots only reference them)
     for (int i = 0; i < BANK_SIZE; ++i) {
-        if (slots_[i].occupied && slots_[i].texture_id != 0) {
-            glDeleteTextures(1, &slots_[i].texture_id);
-        }
         slots_[i] = SpriteSlot();  // Reset to default state
     }
+    for (SpriteAtlasPage& page : pages_) {
+        if (page.texture_id != 0) {
+            glDeleteTextures(1, &page.texture_id);
+        }
+    }
+    pages_.clear();
     
     sprite_count_ = 0;
     initialized_ = false;
@@ -90,10 +87,7 @@ void SpriteBank::release_sprite(int slot) {
     
     // Note: This should be called with bank_mutex_ already locked
     
-    if (slots_[slot].texture_id != 0) {
-        glDeleteTextures(1, &slots_[slot].texture_id);
-    }
-    
+    free_sprite_region(slots_[slot]);
     slots_[slot] = SpriteSlot();  // Reset to default state
     sprite_count_--;
 }
@@ -112,6 +106,41 @@ GLuint SpriteBank::get_texture(int slot) const {
     return 0;
 }
 
+bool SpriteBank::get_sprite_region(int slot, SpriteRegion& region) const {
+    if (!is_valid_slot(slot)) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(bank_mutex_);
+    
+    const SpriteSlot& sprite = slots_[slot];
+    if (!sprite.occupied || sprite.page < 0) {
+        return false;
+    }
+    
+    const SpriteAtlasPage& page = pages_[sprite.page];
+    region.texture_id = page.texture_id;
+    region.width = sprite.width;
+    region.height = sprite.height;
+    region.u0 = (float)sprite.pixel_x / page.width;
+    region.v0 = (float)sprite.pixel_y / page.height;
+    region.u1 = (float)(sprite.pixel_x + sprite.width) / page.width;
+    region.v1 = (float)(sprite.pixel_y + sprite.height) / page.height;
+    return true;
+}
+
+int SpriteBank::get_page_count() const {
+    std::lock_guard<std::mutex> lock(bank_mutex_);
+    
+    int count = 0;
+    for (const SpriteAtlasPage& page : pages_) {
+        if (page.texture_id != 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
 bool SpriteBank::is_occupied(int slot) const {
     if (!is_valid_slot(slot)) {
         return false;
@@ -216,17 +245,14 @@ bool SpriteBank::load_png_on_main_thread(const std::string& filename, int slot)
             cairo_surface_destroy(png_surface);
         }
         
-        // Create fallback texture
-        GLuint texture_id = create_empty_texture();
-        if (texture_id != 0) {
-            std::lock_guard<std::mutex> lock(bank_mutex_);
+        // Use a placeholder image so the slot is still drawable
+        std::vector<unsigned char> pixels = create_empty_pixels();
+        std::lock_guard<std::mutex> lock(bank_mutex_);
+        if (place_sprite(slot, pixels.data(), DEFAULT_SPRITE_SIZE, DEFAULT_SPRITE_SIZE)) {
             slots_[slot].occupied = true;
-            slots_[slot].texture_id = texture_id;
-            slots_[slot].width = DEFAULT_SPRITE_SIZE;
-            slots_[slot].height = DEFAULT_SPRITE_SIZE;
             slots_[slot].source_file = filename;
             sprite_count_++;
-            return true;  // Fallback texture created successfully
+            return true;  // Fallback sprite created successfully
         }
         return false;
     }
@@ -273,49 +299,28 @@ bool SpriteBank::load_png_on_main_thread(const std::string& filename, int slot)
         }
     }
     
-    // Create OpenGL texture (we're on main thread now)
-    GLuint texture_id = 0;
-    glGenTextures(1, &texture_id);
-    glBindTexture(GL_TEXTURE_2D, texture_id);
-    
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba_data.data());
-    
-    // Set texture parameters for pixel-perfect sprites
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    
     cairo_surface_destroy(png_surface);
     
-    // Store sprite information
+    // Pack into the atlas (we're on main thread now) and store sprite information
+    int page = -1;
     {
         std::lock_guard<std::mutex> lock(bank_mutex_);
+        if (!place_sprite(slot, rgba_data.data(), width, height)) {
+            return false;
+        }
         slots_[slot].occupied = true;
-        slots_[slot].texture_id = texture_id;
-        slots_[slot].width = width;
-        slots_[slot].height = height;
         slots_[slot].source_file = filename;
+        page = slots_[slot].page;
         sprite_count_++;
     }
 
     std::cout << "[Sprite Bank] Successfully loaded PNG: " << filename 
-              << " (" << width << "x" << height << ") -> texture " << texture_id << std::endl;
+              << " (" << width << "x" << height << ") -> atlas page " << page << std::endl;
     
     return true;
 }
 
-GLuint SpriteBank::create_empty_texture() {
-
-    GLuint texture_id = 0;
-    glGenTextures(1, &texture_id);
-    if (texture_id == 0) {
-        std::cerr << "[Sprite Bank] ERROR: glGenTextures failed to create texture!" << std::endl;
-        return 0;
-    }
-
-    glBindTexture(GL_TEXTURE_2D, texture_id);
-    
+std::vector<unsigned char> SpriteBank::create_empty_pixels() const {
     // Create a simple checkerboard pattern for debugging
     const int size = DEFAULT_SPRITE_SIZE;
     std::vector<uint32_t> pixels(size * size);
@@ -331,14 +336,152 @@ GLuint SpriteBank::create_empty_texture() {
         }
     }
     
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    std::vector<unsigned char> rgba(pixels.size() * 4);
+    memcpy(rgba.data(), pixels.data(), rgba.size());
+    return rgba;
+}
+
+// =============================================================================
+// ATLAS PAGES
+// =============================================================================
+
+int SpriteBank::create_page(bool shared, int width, int height) {
+    GLuint texture_id = 0;
+    glGenTextures(1, &texture_id);
+    if (texture_id == 0) {
+        std::cerr << "[Sprite Bank] ERROR: glGenTextures failed to create atlas page!" << std::endl;
+        return -1;
+    }
+    
+    // Storage only; every texel a sprite can sample is written when it is placed
+    glBindTexture(GL_TEXTURE_2D, texture_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     
+    SpriteAtlasPage page;
+    page.texture_id = texture_id;
+    page.width = width;
+    page.height = height;
+    page.shared = shared;
+    if (shared) {
+        // Hand out cells from the top-left first
+        for (int cell = CELLS_PER_PAGE - 1; cell >= 0; --cell) {
+            page.free_cells.push_back(cell);
+        }
+    }
+    
+    // Reuse the entry of a released page so page indices stay small
+    for (size_t i = 0; i < pages_.size(); ++i) {
+        if (pages_[i].texture_id == 0) {
+            pages_[i] = page;
+            return (int)i;
+        }
+    }
+    pages_.push_back(page);
+    return (int)pages_.size() - 1;
+}
+
+bool SpriteBank::place_sprite(int slot, const unsigned char* rgba, int width, int height) {
+    SpriteSlot& sprite = slots_[slot];
+    
+    if (width > CELL_SIZE || height > CELL_SIZE) {
+        int page = create_page(false, width, height);
+        if (page < 0) {
+            return false;
+        }
+        glBindTexture(GL_TEXTURE_2D, pages_[page].texture_id);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+        
+        sprite.page = page;
+        sprite.cell = -1;
+        sprite.pixel_x = 0;
+        sprite.pixel_y = 0;
+    } else {
+        int page = -1;
+        for (size_t i = 0; i < pages_.size(); ++i) {
+            if (pages_[i].shared && !pages_[i].free_cells.empty()) {
+                page = (int)i;
+                break;
+            }
+        }
+        if (page < 0) {
+            page = create_page(true, PAGE_SIZE, PAGE_SIZE);
+            if (page < 0) {
+                return false;
+            }
+        }
+        
+        int cell = pages_[page].free_cells.back();
+        pages_[page].free_cells.pop_back();
+        int cell_x = (cell % CELLS_PER_ROW) * CELL_STRIDE;
+        int cell_y = (cell / CELLS_PER_ROW) * CELL_STRIDE;
+        
+        // Surround the image with a copy of its edge pixels, which is what
+        // clamped sampling of a texture of its own would have produced
+        int padded_width = width + 2;
+        int padded_height = height + 2;
+        std::vector<unsigned char> padded((size_t)padded_width * padded_height * 4);
+        for (int y = 0; y < padded_height; ++y) {
+            int src_y = std::min(std::max(y - 1, 0), height - 1);
+            for (int x = 0; x < padded_width; ++x) {
+                int src_x = std::min(std::max(x - 1, 0), width - 1);
+                memcpy(&padded[((size_t)y * padded_width + x) * 4],
+                       &rgba[((size_t)src_y * width + src_x) * 4], 4);
+            }
+        }
+        
+        glBindTexture(GL_TEXTURE_2D, pages_[page].texture_id);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, cell_x, cell_y, padded_width, padded_height,
+                        GL_RGBA, GL_UNSIGNED_BYTE, padded.data());
+        
+        sprite.page = page;
+        sprite.cell = cell;
+        sprite.pixel_x = cell_x + 1;
+        sprite.pixel_y = cell_y + 1;
+    }
+    
+    glBindTexture(GL_TEXTURE_2D, 0);
+    sprite.texture_id = pages_[sprite.page].texture_id;
+    sprite.width = width;
+    sprite.height = height;
+    return true;
+}
 
-    return texture_id;
+void SpriteBank::free_sprite_region(SpriteSlot& sprite) {
+    if (sprite.page < 0 || sprite.page >= (int)pages_.size()) {
+        return;
+    }
+    
+    SpriteAtlasPage& page = pages_[sprite.page];
+    if (sprite.cell >= 0) {
+        page.free_cells.push_back(sprite.cell);
+    } else if (page.texture_id != 0) {
+        glDeleteTextures(1, &page.texture_id);
+        page = SpriteAtlasPage();
+    }
+    sprite.page = -1;
+    sprite.cell = -1;
+}
+
+void SpriteBank::read_sprite_pixels(const SpriteSlot& sprite, std::vector<unsigned char>& data) const {
+    const SpriteAtlasPage& page = pages_[sprite.page];
+    
+    // Read the whole page from the GPU and crop the sprite out of it
+    std::vector<unsigned char> page_data((size_t)page.width * page.height * 4);
+    glBindTexture(GL_TEXTURE_2D, page.texture_id);
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, page_data.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+    
+    size_t row_bytes = (size_t)sprite.width * 4;
+    data.resize(row_bytes * sprite.height);
+    for (int y = 0; y < sprite.height; ++y) {
+        memcpy(&data[y * row_bytes],
+               &page_data[(((size_t)sprite.pixel_y + y) * page.width + sprite.pixel_x) * 4],
+               row_bytes);
+    }
 }
 
 bool SpriteBank::save_sprite_as_png(int slot, const std::string& output_filename) {
@@ -356,13 +499,10 @@ bool SpriteBank::save_sprite_as_png(int slot, const std::string& output_filename
     
     int width = slots_[slot].width;
     int height = slots_[slot].height;
-    GLuint texture_id = slots_[slot].texture_id;
     
     // Read texture data from GPU
-    std::vector<unsigned char> rgba_data(width * height * 4);
-    
-    glBindTexture(GL_TEXTURE_2D, texture_id);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba_data.data());
+    std::vector<unsigned char> rgba_data;
+    read_sprite_pixels(slots_[slot], rgba_data);
     
     // Create Cairo surface for PNG output
     cairo_surface_t* surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, width, height);
@@ -435,15 +575,9 @@ std::string SpriteBank::hash_sprite_data(int slot) {
         return "";
     }
     
-    int width = slots_[slot].width;
-    int height = slots_[slot].height;
-    GLuint texture_id = slots_[slot].texture_id;
-    
     // Read texture data from GPU
-    std::vector<unsigned char> rgba_data(width * height * 4);
-    
-    glBindTexture(GL_TEXTURE_2D, texture_id);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba_data.data());
+    std::vector<unsigned char> rgba_data;
+    read_sprite_pixels(slots_[slot], rgba_data);
     
     // Simple hash: sum of all bytes modulo large prime
     uint64_t hash = 0;
@@ -494,13 +628,9 @@ bool SpriteBank::get_texture_data(int slot, std::vector<unsigned char>& data, in
     
     width = slots_[slot].width;
     height = slots_[slot].height;
-    GLuint texture_id = slots_[slot].texture_id;
     
     // Read texture data from GPU
-    data.resize(width * height * 4);
-    
-    glBindTexture(GL_TEXTURE_2D, texture_id);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
+    read_sprite_pixels(slots_[slot], data);
     
     return true;
 }
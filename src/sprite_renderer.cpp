@@ -12,7 +12,16 @@ SpriteRenderer::SpriteRenderer()
     , sprite_bank_(nullptr)
     , screen_width_(800)
     , screen_height_(600)
-    , active_count_(0) {
+    , active_count_(0)
+    , draw_order_dirty_(false)
+    , draw_order_changes_(0)
+    , back_snapshot_(0)
+    , front_snapshot_(1)
+    , ready_snapshot_(2)
+    , snapshot_stale_(false)
+    , open_batches_(0)
+    , publish_count_(0)
+    , last_draw_calls_(0) {
 }
 
 SpriteRenderer::~SpriteRenderer() {
@@ -34,13 +43,26 @@ bool SpriteRenderer::initialize(SpriteBank* sprite_bank, int screen_width, int s
     screen_height_ = screen_height;
     active_count_ = 0;
     
-    // Initialize all instances as inactive
-    for (int i = 0; i < MAX_INSTANCES; ++i) {
-        instances_[i] = SpriteInstance();
-    }
+    // The pool starts empty and grows as instances are created
+    instances_.clear();
+    dense_indices_.clear();
+    handles_.clear();
+    free_indices_.clear();
+    draw_order_.clear();
+    draw_order_dirty_ = false;
+    draw_order_changes_ = 0;
+    for (std::vector<SpriteInstance>& snapshot : snapshots_) {
+        snapshot.clear();
+    }
+    back_snapshot_ = 0;
+    front_snapshot_ = 1;
+    ready_snapshot_.store(2);
+    snapshot_stale_.store(false);
+    open_batches_ = 0;
     
     initialized_ = true;
-    std::cout << "SpriteRenderer initialized with " << MAX_INSTANCES << " instance slots" << std::endl;
+    std::cout << "SpriteRenderer initialized (instance pool grows on demand, up to "
+              << MAX_INSTANCES << " instances)" << std::endl;
     return true;
 }
 
@@ -49,12 +71,14 @@ void SpriteRenderer::shutdown() {
         return;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
     // Clear all instances
-    for (int i = 0; i < MAX_INSTANCES; ++i) {
-        instances_[i] = SpriteInstance();
-    }
+    instances_.clear();
+    dense_indices_.clear();
+    handles_.clear();
+    free_indices_.clear();
+    draw_order_.clear();
     
     active_count_ = 0;
     sprite_bank_ = nullptr;
@@ -68,7 +92,7 @@ bool SpriteRenderer::sprite(int instance_id, int sprite_slot, float x, float y)
         return false;
     }
     
-    if (!is_valid_instance_id(instance_id)) {
+    if (instance_id < 0) {
         return false;
     }
     
@@ -80,36 +104,90 @@ bool SpriteRenderer::sprite(int instance_id, int sprite_slot, float x, float y)
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
-    // If this instance wasn't active before, increment counter
-    if (!instances_[instance_id].active) {
-        active_count_++;
+    uint32_t index = (uint32_t)instance_id & INDEX_MASK;
+    uint16_t generation = (uint16_t)((uint32_t)instance_id >> INDEX_BITS);
+    if (index >= handles_.size()) {
+        // Indices skipped over stay available to sprite_create()
+        uint32_t first_gap = (uint32_t)handles_.size();
+        handles_.resize(index + 1);
+        for (uint32_t gap = first_gap; gap < index; ++gap) {
+            release_index(gap);
+        }
     }
     
-    instances_[instance_id].active = true;
-    instances_[instance_id].sprite_slot = sprite_slot;
-    instances_[instance_id].x = x;
-    instances_[instance_id].y = y;
-    instances_[instance_id].scale_x = 1.0f;
-    instances_[instance_id].scale_y = 1.0f;
-    instances_[instance_id].rotation = 0.0f;
-    instances_[instance_id].alpha = 1.0f;
-    instances_[instance_id].z_order = 0;
+    // Claim a free index, or update the live instance with this ID
+    if (handles_[index].dense < 0) {
+        insert_instance(index, generation);
+    } else if (handles_[index].generation != generation) {
+        return false;
+    }
     
+    start_instance(handles_[index].dense, sprite_slot, x, y);
+    note_write();
+    return true;
+}
 
+int SpriteRenderer::sprite_create(int sprite_slot, float x, float y) {
+    if (!initialized_ || !sprite_bank_ || !sprite_bank_->is_occupied(sprite_slot)) {
+        return -1;
+    }
+    
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    
+    // Reuse a released index (skipping any reclaimed by ID since), or grow
+    while (!free_indices_.empty() && handles_[free_indices_.back()].dense >= 0) {
+        handles_[free_indices_.back()].in_free_list = false;
+        free_indices_.pop_back();
+    }
+    
+    uint32_t index;
+    if (!free_indices_.empty()) {
+        index = free_indices_.back();
+        free_indices_.pop_back();
+        handles_[index].in_free_list = false;
+    } else {
+        if (handles_.size() >= (size_t)MAX_INSTANCES) {
+            return -1;
+        }
+        index = (uint32_t)handles_.size();
+        handles_.push_back(InstanceHandle());
+    }
+    
+    // Generation 0 is left to IDs chosen by the caller
+    uint16_t generation = handles_[index].next_generation;
+    
+    start_instance(insert_instance(index, generation), sprite_slot, x, y);
+    note_write();
+    return (int)(((uint32_t)generation << INDEX_BITS) | index);
+}
+
+bool SpriteRenderer::sprite_destroy(int instance_id) {
+    if (!initialized_) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    
+    if (!find_instance(instance_id)) {
+        return false;
+    }
     
+    remove_instance((uint32_t)instance_id & INDEX_MASK);
+    note_write();
     return true;
 }
 
 bool SpriteRenderer::sprite_move(int instance_id, float x, float y) {
-    if (!initialized_ || !is_valid_instance_id(instance_id)) {
+    if (!initialized_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
-    if (!instances_[instance_id].active) {
+    SpriteInstance* instance = find_instance(instance_id);
+    if (!instance || !instance->active) {
         return false;
     }
     
@@ -118,20 +196,22 @@ bool SpriteRenderer::sprite_move(int instance_id, float x, float y) {
         return false;
     }
     
-    instances_[instance_id].x = x;
-    instances_[instance_id].y = y;
+    instance->x = x;
+    instance->y = y;
+    note_write();
     
     return true;
 }
 
 bool SpriteRenderer::sprite_scale(int instance_id, float scale_x, float scale_y) {
-    if (!initialized_ || !is_valid_instance_id(instance_id)) {
+    if (!initialized_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
-    if (!instances_[instance_id].active) {
+    SpriteInstance* instance = find_instance(instance_id);
+    if (!instance || !instance->active) {
         return false;
     }
     
@@ -141,20 +221,22 @@ bool SpriteRenderer::sprite_scale(int instance_id, float scale_x, float scale_y)
         return false;
     }
     
-    instances_[instance_id].scale_x = scale_x;
-    instances_[instance_id].scale_y = scale_y;
+    instance->scale_x = scale_x;
+    instance->scale_y = scale_y;
+    note_write();
     
     return true;
 }
 
 bool SpriteRenderer::sprite_rotate(int instance_id, float degrees) {
-    if (!initialized_ || !is_valid_instance_id(instance_id)) {
+    if (!initialized_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
-    if (!instances_[instance_id].active) {
+    SpriteInstance* instance = find_instance(instance_id);
+    if (!instance || !instance->active) {
         return false;
     }
     
@@ -163,74 +245,141 @@ bool SpriteRenderer::sprite_rotate(int instance_id, float degrees) {
         return false;
     }
     
-    instances_[instance_id].rotation = degrees;
+    instance->rotation = degrees;
+    note_write();
     
     return true;
 }
 
 bool SpriteRenderer::sprite_alpha(int instance_id, float alpha) {
-    if (!initialized_ || !is_valid_instance_id(instance_id)) {
+    if (!initialized_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
-    if (!instances_[instance_id].active) {
+    SpriteInstance* instance = find_instance(instance_id);
+    if (!instance || !instance->active) {
         return false;
     }
     
     // Clamp alpha to valid range
-    instances_[instance_id].alpha = std::max(0.0f, std::min(1.0f, alpha));
+    instance->alpha = std::max(0.0f, std::min(1.0f, alpha));
+    note_write();
     
     return true;
 }
 
 bool SpriteRenderer::sprite_z_order(int instance_id, int z_order) {
-    if (!initialized_ || !is_valid_instance_id(instance_id)) {
+    if (!initialized_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
-    if (!instances_[instance_id].active) {
+    SpriteInstance* instance = find_instance(instance_id);
+    if (!instance || !instance->active) {
         return false;
     }
     
-    instances_[instance_id].z_order = z_order;
+    if (instance->z_order != z_order) {
+        instance->z_order = z_order;
+        mark_draw_order_changed();
+        note_write();
+    }
     
     return true;
 }
 
+// Element of an array whose entries are step bytes apart (nullptr stays nullptr)
+template <typename T>
+static const T* strided_element(const T* base, size_t step, int i) {
+    return base ? reinterpret_cast<const T*>(reinterpret_cast<const char*>(base) + step * i) : nullptr;
+}
+
+static bool is_finite_value(const float* value) {
+    return !value || (!std::isnan(*value) && !std::isinf(*value));
+}
+
+int SpriteRenderer::sprite_update_many(const int* ids, const float* xs, const float* ys,
+                                       const float* rotations, const float* scales,
+                                       const float* alphas, int count, size_t stride) {
+    static_assert(sizeof(int) == sizeof(float), "Packed ID and value arrays share a step");
+    if (!initialized_ || !ids || count <= 0) {
+        return 0;
+    }
+    
+    size_t step = stride ? stride : sizeof(float);
+    int updated = 0;
+    
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    
+    for (int i = 0; i < count; ++i) {
+        SpriteInstance* instance = find_instance(*strided_element(ids, step, i));
+        if (!instance || !instance->active) {
+            continue;
+        }
+        
+        const float* x = strided_element(xs, step, i);
+        const float* y = strided_element(ys, step, i);
+        const float* rotation = strided_element(rotations, step, i);
+        const float* scale = strided_element(scales, step, i);
+        const float* alpha = strided_element(alphas, step, i);
+        
+        // Same checks as the single-property setters, applied to the whole entry
+        if (!is_finite_value(x) || !is_finite_value(y) || !is_finite_value(rotation) ||
+            !is_finite_value(scale) || (scale && *scale <= 0.0f)) {
+            continue;
+        }
+        
+        if (x) instance->x = *x;
+        if (y) instance->y = *y;
+        if (rotation) instance->rotation = *rotation;
+        if (scale) {
+            instance->scale_x = *scale;
+            instance->scale_y = *scale;
+        }
+        if (alpha) instance->alpha = std::max(0.0f, std::min(1.0f, *alpha));
+        updated++;
+    }
+    
+    if (updated > 0) {
+        note_write();
+    }
+    return updated;
+}
+
 bool SpriteRenderer::sprite_hide(int instance_id) {
-    if (!initialized_ || !is_valid_instance_id(instance_id)) {
+    if (!initialized_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
-    if (instances_[instance_id].active) {
-        instances_[instance_id].active = false;
-        active_count_--;
+    SpriteInstance* instance = find_instance(instance_id);
+    if (!instance) {
+        return false;
     }
     
+    set_instance_active(handles_[(uint32_t)instance_id & INDEX_MASK].dense, false);
+    note_write();
     return true;
 }
 
 bool SpriteRenderer::sprite_show(int instance_id) {
-    if (!initialized_ || !is_valid_instance_id(instance_id)) {
+    if (!initialized_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    
+    SpriteInstance* instance = find_instance(instance_id);
     
     // Can only show if it has a valid sprite slot
-    if (instances_[instance_id].sprite_slot >= 0 && 
-        sprite_bank_ && sprite_bank_->is_occupied(instances_[instance_id].sprite_slot)) {
-        
-        if (!instances_[instance_id].active) {
-            instances_[instance_id].active = true;
-            active_count_++;
-        }
+    if (instance && instance->sprite_slot >= 0 && 
+        sprite_bank_ && sprite_bank_->is_occupied(instance->sprite_slot)) {
+        set_instance_active(handles_[(uint32_t)instance_id & INDEX_MASK].dense, true);
+        note_write();
         return true;
     }
     
@@ -238,12 +387,13 @@ bool SpriteRenderer::sprite_show(int instance_id) {
 }
 
 bool SpriteRenderer::sprite_is_visible(int instance_id) const {
-    if (!initialized_ || !is_valid_instance_id(instance_id)) {
+    if (!initialized_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
-    return instances_[instance_id].active;
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    const SpriteInstance* instance = find_instance(instance_id);
+    return instance && instance->active;
 }
 
 void SpriteRenderer::hide_all_sprites() {
@@ -251,13 +401,21 @@ void SpriteRenderer::hide_all_sprites() {
         return;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     
-    for (int i = 0; i < MAX_INSTANCES; ++i) {
+    // Every instance is already on the hidden side of the partition once
+    // the visible count is zero
+    for (int i = 0; i < active_count_; ++i) {
         instances_[i].active = false;
     }
     
     active_count_ = 0;
+    
+    for (const DrawOrderEntry& entry : draw_order_) {
+        handles_[entry.index].in_draw_order = false;
+    }
+    draw_order_.clear();
+    note_write();
 }
 
 int SpriteRenderer::get_active_count() const {
@@ -265,22 +423,64 @@ int SpriteRenderer::get_active_count() const {
         return 0;
     }
     
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     return active_count_;
 }
 
+void SpriteRenderer::begin_updates() {
+    if (!initialized_) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    open_batches_++;
+}
+
+void SpriteRenderer::commit_updates() {
+    if (!initialized_) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    if (open_batches_ == 0) {
+        return;
+    }
+    
+    // The whole batch becomes visible in one frame
+    open_batches_--;
+    if (open_batches_ == 0 && snapshot_stale_.load(std::memory_order_relaxed)) {
+        publish_snapshot();
+    }
+}
+
+int SpriteRenderer::get_instance_count() const {
+    if (!initialized_) {
+        return 0;
+    }
+    
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return (int)instances_.size();
+}
+
 void SpriteRenderer::render_sprites() {
-    if (!initialized_ || !sprite_bank_ || active_count_ == 0) {
+    last_draw_calls_ = 0;
+    if (!initialized_ || !sprite_bank_) {
         return;
     }
     
-    // Get sorted list of visible sprites
-    std::vector<int> visible_sprites = get_sorted_visible_sprites();
+    // Get the visible sprites in draw order without waiting for writers
+    collect_visible_sprites(acquire_snapshot());
     
-    if (visible_sprites.empty()) {
+    if (draws_.empty()) {
         return;
     }
     
+    // Transform every sprite into one vertex array
+    vertices_.clear();
+    for (const SpriteDraw& draw : draws_) {
+        append_sprite_quad(draw.instance, draw.region);
+    }
+    
     // Set up OpenGL state once for all sprites
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -298,20 +498,34 @@ void SpriteRenderer::render_sprites() {
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
     
-    // Batch render sprites by texture to reduce texture binding
-    GLuint current_texture = 0;
-    for (int instance_id : visible_sprites) {
-        const SpriteInstance& instance = instances_[instance_id];
-        GLuint texture_id = sprite_bank_->get_texture(instance.sprite_slot);
-        
-        if (texture_id != current_texture) {
-            glBindTexture(GL_TEXTURE_2D, texture_id);
-            current_texture = texture_id;
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, FLOATS_PER_VERTEX * sizeof(float), &vertices_[0]);
+    glTexCoordPointer(2, GL_FLOAT, FLOATS_PER_VERTEX * sizeof(float), &vertices_[2]);
+    glColorPointer(4, GL_FLOAT, FLOATS_PER_VERTEX * sizeof(float), &vertices_[4]);
+    
+    // One draw call per run of sprites on the same atlas page
+    size_t first = 0;
+    while (first < draws_.size()) {
+        GLuint texture_id = draws_[first].region.texture_id;
+        size_t last = first + 1;
+        while (last < draws_.size() && draws_[last].region.texture_id == texture_id) {
+            last++;
         }
         
-        render_sprite_instance_optimized(instance);
+        glBindTexture(GL_TEXTURE_2D, texture_id);
+        glDrawArrays(GL_QUADS, (GLint)(first * 4), (GLsizei)((last - first) * 4));
+        last_draw_calls_++;
+        first = last;
     }
     
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);  // Current color is undefined after a color array
+    
     // Restore matrices
     glMatrixMode(GL_PROJECTION);
     glPopMatrix();
@@ -324,127 +538,316 @@ void SpriteRenderer::render_sprites() {
 }
 
 void SpriteRenderer::update_screen_size(int width, int height) {
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
     screen_width_ = width;
     screen_height_ = height;
 }
 
-bool SpriteRenderer::is_valid_instance_id(int instance_id) const {
-    return instance_id >= 0 && instance_id < MAX_INSTANCES;
+SpriteInstance* SpriteRenderer::find_instance(int instance_id) {
+    return const_cast<SpriteInstance*>(static_cast<const SpriteRenderer*>(this)->find_instance(instance_id));
 }
 
-bool SpriteRenderer::is_sprite_on_screen(const SpriteInstance& instance, 
-                                       int sprite_width, int sprite_height) const {
-    // Calculate sprite bounds with scaling
-    float scaled_width = sprite_width * std::abs(instance.scale_x);
-    float scaled_height = sprite_height * std::abs(instance.scale_y);
-    
-    // Simple bounding box check (ignoring rotation for now)
-    float left = instance.x - scaled_width * 0.5f;
-    float right = instance.x + scaled_width * 0.5f;
-    float top = instance.y - scaled_height * 0.5f;
-    float bottom = instance.y + scaled_height * 0.5f;
+const SpriteInstance* SpriteRenderer::find_instance(int instance_id) const {
+    if (instance_id < 0) {
+        return nullptr;
+    }
     
-    // Check if sprite is completely off screen
-    if (right < 0 || left > screen_width_ || bottom < 0 || top > screen_height_) {
-        return false;
+    uint32_t index = (uint32_t)instance_id & INDEX_MASK;
+    uint32_t generation = (uint32_t)instance_id >> INDEX_BITS;
+    if (index >= handles_.size()) {
+        return nullptr;
     }
     
-    return true;
+    const InstanceHandle& handle = handles_[index];
+    if (handle.dense < 0 || handle.generation != generation) {
+        return nullptr;
+    }
+    return &instances_[handle.dense];
 }
 
-void SpriteRenderer::render_sprite_instance(const SpriteInstance& instance) {
-    // Get sprite texture from bank
-    GLuint texture_id = sprite_bank_->get_texture(instance.sprite_slot);
-    if (texture_id == 0) {
-        return;
+int SpriteRenderer::insert_instance(uint32_t index, uint16_t generation) {
+    int dense = (int)instances_.size();
+    instances_.push_back(SpriteInstance());
+    dense_indices_.push_back(index);
+    handles_[index].dense = dense;
+    handles_[index].generation = generation;
+    return dense;
+}
+
+void SpriteRenderer::remove_instance(uint32_t index) {
+    set_instance_active(handles_[index].dense, false);
+    
+    // Fill the gap with the last instance
+    int dense = handles_[index].dense;
+    swap_instances(dense, (int)instances_.size() - 1);
+    instances_.pop_back();
+    dense_indices_.pop_back();
+    
+    InstanceHandle& handle = handles_[index];
+    handle.dense = -1;
+    handle.next_generation = (handle.next_generation >= MAX_GENERATION) ? 1 : handle.next_generation + 1;
+    release_index(index);
+}
+
+void SpriteRenderer::release_index(uint32_t index) {
+    // An index reclaimed by ID keeps its stale entry, so a later release
+    // must not list it again
+    InstanceHandle& handle = handles_[index];
+    if (!handle.in_free_list) {
+        free_indices_.push_back(index);
+        handle.in_free_list = true;
     }
-    
-    // Get sprite dimensions
-    int sprite_width, sprite_height;
-    if (!sprite_bank_->get_sprite_size(instance.sprite_slot, sprite_width, sprite_height)) {
+}
+
+void SpriteRenderer::set_instance_active(int dense, bool active) {
+    if (instances_[dense].active == active) {
         return;
     }
     
-    // Skip if completely off screen
-    if (!is_sprite_on_screen(instance, sprite_width, sprite_height)) {
-        return;
+    if (active) {
+        // Swap into the first hidden position, then grow the visible range
+        swap_instances(dense, active_count_);
+        instances_[active_count_].active = true;
+        
+        // A hidden instance may still have its entry from before
+        InstanceHandle& handle = handles_[dense_indices_[active_count_]];
+        if (!handle.in_draw_order) {
+            draw_order_.push_back(DrawOrderEntry{ 0, dense_indices_[active_count_] });
+            handle.in_draw_order = true;
+        }
+        mark_draw_order_changed();
+        active_count_++;
+    } else {
+        // Swap into the last visible position, then shrink the visible range;
+        // the draw order entry is dropped at the next update
+        active_count_--;
+        swap_instances(dense, active_count_);
+        instances_[active_count_].active = false;
+        draw_order_dirty_ = true;
     }
-    
-    // Bind the sprite texture
-    glBindTexture(GL_TEXTURE_2D, texture_id);
-    
-    render_sprite_instance_optimized(instance);
 }
 
-void SpriteRenderer::render_sprite_instance_optimized(const SpriteInstance& instance) {
-    // Get sprite dimensions (assume already validated)
-    int sprite_width, sprite_height;
-    if (!sprite_bank_->get_sprite_size(instance.sprite_slot, sprite_width, sprite_height)) {
+void SpriteRenderer::swap_instances(int a, int b) {
+    if (a == b) {
         return;
     }
     
-    // Set sprite color with alpha
-    glColor4f(1.0f, 1.0f, 1.0f, instance.alpha);
+    std::swap(instances_[a], instances_[b]);
+    std::swap(dense_indices_[a], dense_indices_[b]);
+    handles_[dense_indices_[a]].dense = a;
+    handles_[dense_indices_[b]].dense = b;
+}
+
+void SpriteRenderer::start_instance(int dense, int sprite_slot, float x, float y) {
+    SpriteInstance& instance = instances_[dense];
+    if (instance.active && (instance.sprite_slot != sprite_slot || instance.z_order != 0)) {
+        mark_draw_order_changed();
+    }
+    
+    instance.sprite_slot = sprite_slot;
+    instance.x = x;
+    instance.y = y;
+    instance.scale_x = 1.0f;
+    instance.scale_y = 1.0f;
+    instance.rotation = 0.0f;
+    instance.alpha = 1.0f;
+    instance.z_order = 0;
+    
+    set_instance_active(dense, true);
+}
+
+bool SpriteRenderer::is_sprite_on_screen(const SpriteInstance& instance, 
+                                       int sprite_width, int sprite_height) const {
+    // Calculate sprite bounds with scaling
+    float half_width = sprite_width * std::abs(instance.scale_x) * 0.5f;
+    float half_height = sprite_height * std::abs(instance.scale_y) * 0.5f;
     
-    // Save current transform
-    glPushMatrix();
+    // A rotated sprite stays within the circle through its corners
+    if (instance.rotation != 0.0f) {
+        half_width = half_height = std::sqrt(half_width * half_width + half_height * half_height);
+    }
     
-    // Transform to sprite position and apply transformations
-    glTranslatef(instance.x, instance.y, 0.0f);
+    float left = instance.x - half_width;
+    float right = instance.x + half_width;
+    float top = instance.y - half_height;
+    float bottom = instance.y + half_height;
     
-    if (instance.rotation != 0.0f) {
-        glRotatef(instance.rotation, 0.0f, 0.0f, 1.0f);
+    // Check if sprite is completely off screen
+    if (right < 0 || left > screen_width_ || bottom < 0 || top > screen_height_) {
+        return false;
     }
     
-    glScalef(instance.scale_x, instance.scale_y, 1.0f);
+    return true;
+}
+
+void SpriteRenderer::publish_snapshot() {
+    update_draw_order();
     
-    // Calculate quad vertices (centered on origin)
-    float half_width = sprite_width * 0.5f;
-    float half_height = sprite_height * 0.5f;
+    std::vector<SpriteInstance>& snapshot = snapshots_[back_snapshot_];
+    snapshot.resize(draw_order_.size());
+    for (size_t i = 0; i < draw_order_.size(); ++i) {
+        snapshot[i] = instances_[handles_[draw_order_[i].index].dense];
+    }
     
-    // Render textured quad
-    glBegin(GL_QUADS);
-        // Bottom-left
-        glTexCoord2f(0.0f, 1.0f);
-        glVertex2f(-half_width, half_height);
-        
-        // Bottom-right
-        glTexCoord2f(1.0f, 1.0f);
-        glVertex2f(half_width, half_height);
-        
-        // Top-right
-        glTexCoord2f(1.0f, 0.0f);
-        glVertex2f(half_width, -half_height);
-        
-        // Top-left
-        glTexCoord2f(0.0f, 0.0f);
-        glVertex2f(-half_width, -half_height);
-    glEnd();
+    // Hand the filled buffer over and take back whichever one was waiting
+    int previous = ready_snapshot_.exchange(back_snapshot_ | SNAPSHOT_NEW, std::memory_order_acq_rel);
+    back_snapshot_ = previous & ~SNAPSHOT_NEW;
+    snapshot_stale_.store(false, std::memory_order_relaxed);
+    publish_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+const std::vector<SpriteInstance>& SpriteRenderer::acquire_snapshot() {
+    // Publish pending changes between two complete writes, unless a batch
+    // is open (its commit publishes) or a writer holds the lock right now
+    if (snapshot_stale_.load(std::memory_order_relaxed) && writer_mutex_.try_lock()) {
+        if (snapshot_stale_.load(std::memory_order_relaxed) && open_batches_ == 0) {
+            publish_snapshot();
+        }
+        writer_mutex_.unlock();
+    }
     
-    // Restore transform
-    glPopMatrix();
+    if (ready_snapshot_.load(std::memory_order_relaxed) & SNAPSHOT_NEW) {
+        int ready = ready_snapshot_.exchange(front_snapshot_, std::memory_order_acq_rel);
+        front_snapshot_ = ready & ~SNAPSHOT_NEW;
+    }
+    return snapshots_[front_snapshot_];
+}
+
+void SpriteRenderer::collect_visible_sprites(const std::vector<SpriteInstance>& snapshot) {
+    // Look up each sprite's atlas region once per frame and drop
+    // off-screen sprites
+    draws_.resize(snapshot.size());
+    region_cache_.resize(SpriteBank::BANK_SIZE);
+    region_state_.assign(SpriteBank::BANK_SIZE, 0);
+    size_t kept = 0;
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        const SpriteInstance& instance = snapshot[i];
+        int slot = instance.sprite_slot;
+        if (slot < 0 || slot >= SpriteBank::BANK_SIZE) {
+            continue;
+        }
+        if (region_state_[slot] == 0) {
+            bool valid = sprite_bank_->get_sprite_region(slot, region_cache_[slot]) &&
+                         region_cache_[slot].texture_id != 0;
+            region_state_[slot] = valid ? 1 : -1;
+        }
+        const SpriteRegion& region = region_cache_[slot];
+        if (region_state_[slot] < 0 || !is_sprite_on_screen(instance, region.width, region.height)) {
+            continue;
+        }
+        draws_[kept].instance = instance;
+        draws_[kept].region = region;
+        kept++;
+    }
+    draws_.resize(kept);
+}
+
+// Sort a nearly sorted draw order in place (cheap when few keys changed)
+void SpriteRenderer::insertion_sort_draw_order(std::vector<DrawOrderEntry>& entries) {
+    for (size_t i = 1; i < entries.size(); ++i) {
+        DrawOrderEntry entry = entries[i];
+        size_t j = i;
+        while (j > 0 && entries[j - 1].key > entry.key) {
+            entries[j] = entries[j - 1];
+            --j;
+        }
+        entries[j] = entry;
+    }
 }
 
-std::vector<int> SpriteRenderer::get_sorted_visible_sprites() const {
-    std::lock_guard<std::mutex> lock(renderer_mutex_);
+// Stable LSD radix sort on the 64-bit key, one byte per pass; passes where
+// every key has the same byte (usually most of them) are skipped
+void SpriteRenderer::radix_sort_draw_order(std::vector<DrawOrderEntry>& entries,
+                                           std::vector<DrawOrderEntry>& scratch) {
+    const size_t count = entries.size();
+    size_t histogram[8][256] = {};
+    for (const DrawOrderEntry& entry : entries) {
+        for (int pass = 0; pass < 8; ++pass) {
+            histogram[pass][(entry.key >> (pass * 8)) & 0xFF]++;
+        }
+    }
     
-    std::vector<int> visible_sprites;
+    scratch.resize(count);
+    for (int pass = 0; pass < 8; ++pass) {
+        size_t* buckets = histogram[pass];
+        if (buckets[(entries[0].key >> (pass * 8)) & 0xFF] == count) {
+            continue;
+        }
+        
+        size_t offset = 0;
+        for (int bucket = 0; bucket < 256; ++bucket) {
+            size_t size = buckets[bucket];
+            buckets[bucket] = offset;
+            offset += size;
+        }
+        for (const DrawOrderEntry& entry : entries) {
+            scratch[buckets[(entry.key >> (pass * 8)) & 0xFF]++] = entry;
+        }
+        entries.swap(scratch);
+    }
+}
+
+void SpriteRenderer::update_draw_order() {
+    if (!draw_order_dirty_) {
+        return;
+    }
     
-    // Collect all active sprites
-    for (int i = 0; i < MAX_INSTANCES; ++i) {
-        if (instances_[i].active) {
-            visible_sprites.push_back(i);
+    // Drop entries of hidden or destroyed instances and refresh the keys
+    size_t kept = 0;
+    for (size_t i = 0; i < draw_order_.size(); ++i) {
+        DrawOrderEntry entry = draw_order_[i];
+        InstanceHandle& handle = handles_[entry.index];
+        if (handle.dense < 0 || !instances_[handle.dense].active) {
+            handle.in_draw_order = false;
+            continue;
         }
+        
+        const SpriteInstance& instance = instances_[handle.dense];
+        entry.key = ((uint64_t)((uint32_t)instance.z_order ^ 0x80000000u) << 32) |
+                    (uint32_t)instance.sprite_slot;
+        draw_order_[kept++] = entry;
+    }
+    draw_order_.resize(kept);
+    
+    // Lower z-order is drawn first (behind)
+    if (draw_order_changes_ <= INSERTION_SORT_MAX_CHANGES) {
+        insertion_sort_draw_order(draw_order_);
+    } else if (!draw_order_.empty()) {
+        radix_sort_draw_order(draw_order_, draw_order_scratch_);
     }
     
-    // Sort by z-order (lower z-order rendered first = behind)
-    std::sort(visible_sprites.begin(), visible_sprites.end(), 
-              [this](int a, int b) {
-                  return instances_[a].z_order < instances_[b].z_order;
-              });
+    draw_order_dirty_ = false;
+    draw_order_changes_ = 0;
+}
+
+void SpriteRenderer::append_sprite_quad(const SpriteInstance& instance, const SpriteRegion& region) {
+    // Scale, then rotate about the centre, then translate to the position
+    float half_width = region.width * 0.5f * instance.scale_x;
+    float half_height = region.height * 0.5f * instance.scale_y;
     
-    return visible_sprites;
+    float cos_r = 1.0f;
+    float sin_r = 0.0f;
+    if (instance.rotation != 0.0f) {
+        float radians = instance.rotation * 3.14159265f / 180.0f;
+        cos_r = std::cos(radians);
+        sin_r = std::sin(radians);
+    }
+    
+    // Bottom-left, bottom-right, top-right, top-left
+    const float corner_x[4] = { -half_width, half_width, half_width, -half_width };
+    const float corner_y[4] = { half_height, half_height, -half_height, -half_height };
+    const float corner_u[4] = { region.u0, region.u1, region.u1, region.u0 };
+    const float corner_v[4] = { region.v1, region.v1, region.v0, region.v0 };
+    
+    for (int i = 0; i < 4; ++i) {
+        const float vertex[FLOATS_PER_VERTEX] = {
+            instance.x + corner_x[i] * cos_r - corner_y[i] * sin_r,
+            instance.y + corner_x[i] * sin_r + corner_y[i] * cos_r,
+            corner_u[i], corner_v[i],
+            1.0f, 1.0f, 1.0f, instance.alpha
+        };
+        vertices_.insert(vertices_.end(), vertex, vertex + FLOATS_PER_VERTEX);
+    }
 }
 
 } // namespace AbstractRuntime
\ No newline at end of file
@@ -0,0 +1,740 @@
+#include "text_renderer.h"
+#include "runtime_state.h"
+#include <OpenGL/gl.h>
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <cstddef>
+#include <algorithm>
+
+namespace AbstractRuntime {
+
+// Global text renderer instance
+std::unique_ptr<TextRenderer> g_text_renderer;
+
+// =============================================================================
+// SHADERS (GLSL 1.20 for the OpenGL 2.1 context)
+// =============================================================================
+
+const char* TextRenderer::vertex_shader_source_ = R"(
+#version 120
+attribute vec2 a_position;
+attribute vec2 a_texcoord;
+attribute vec4 a_color;
+uniform mat4 u_projection;
+uniform vec2 u_offset;
+varying vec2 v_texcoord;
+varying vec4 v_color;
+void main() {
+    v_texcoord = a_texcoord;
+    v_color = a_color;
+    gl_Position = u_projection * vec4(a_position + u_offset, 0.0, 1.0);
+}
+)";
+
+// Atlas is GL_ALPHA: glyph coverage in .a, the solid block samples as 1.0
+const char* TextRenderer::fragment_shader_source_ = R"(
+#version 120
+uniform sampler2D u_texture;
+uniform vec4 u_color;
+varying vec2 v_texcoord;
+varying vec4 v_color;
+void main() {
+    float coverage = texture2D(u_texture, v_texcoord).a;
+    gl_FragColor = vec4(v_color.rgb, v_color.a * coverage) * u_color;
+}
+)";
+
+// =============================================================================
+// TEXT BATCH
+// =============================================================================
+
+TextBatch::TextBatch()
+    : vertex_buffer(0)
+    , character_count(0) {
+}
+
+TextBatch::~TextBatch() {
+    // GL objects are released explicitly via release() while the context exists
+}
+
+void TextBatch::clear() {
+    vertices.clear();
+    character_count = 0;
+}
+
+void TextBatch::upload_to_gpu() {
+    if (!vertex_buffer) {
+        glGenBuffers(1, &vertex_buffer);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(TextVertex),
+                 vertices.data(), GL_STREAM_DRAW);
+}
+
+void TextBatch::release() {
+    if (vertex_buffer) {
+        glDeleteBuffers(1, &vertex_buffer);
+        vertex_buffer = 0;
+    }
+    clear();
+}
+
+// =============================================================================
+// TEXT RENDERER
+// =============================================================================
+
+TextRenderer::TextRenderer()
+    : font_atlas_(nullptr)
+    , shader_program_(0)
+    , attrib_position_(-1)
+    , attrib_texcoord_(-1)
+    , attrib_color_(-1)
+    , uniform_projection_(-1)
+    , uniform_texture_(-1)
+    , uniform_color_(-1)
+    , uniform_offset_(-1)
+    , initialized_(false)
+    , alpha_blend_enabled_(true)
+    , grid_vertex_buffer_(0)
+    , grid_cols_(0)
+    , grid_rows_(0)
+    , grid_origin_x_(0)
+    , grid_origin_y_(0)
+    , grid_cell_width_(0)
+    , grid_cell_height_(0)
+    , grid_baseline_(0)
+    , grid_dirty_first_(-1)
+    , grid_dirty_last_(-1)
+    , grid_buffer_allocated_(false)
+    , grid_first_row_(0)
+    , grid_scroll_x_(0.0f)
+    , grid_scroll_y_(0.0f)
+    , cursor_visible_(false)
+    , cursor_x_(0)
+    , cursor_y_(0)
+    , cursor_color_(0xFFFFFF80)
+    , cursor_blink_rate_ms_(DEFAULT_CURSOR_BLINK_RATE)
+    , cursor_last_blink_time_(0)
+    , cursor_blink_state_(true)
+    , characters_rendered_(0)
+    , last_render_time_ms_(0.0f)
+    , debug_mode_(false) {
+    memset(projection_matrix_, 0, sizeof(projection_matrix_));
+}
+
+TextRenderer::~TextRenderer() {
+    shutdown();
+}
+
+bool TextRenderer::initialize(FontAtlas* font_atlas) {
+    if (!font_atlas || !font_atlas->get_texture_id()) {
+        std::cerr << "TextRenderer: font atlas not available" << std::endl;
+        return false;
+    }
+
+    font_atlas_ = font_atlas;
+
+    if (!create_shader_program()) {
+        std::cerr << "TextRenderer: failed to create shader program" << std::endl;
+        return false;
+    }
+
+    glGenBuffers(1, &grid_vertex_buffer_);
+    initialized_ = true;
+    return true;
+}
+
+void TextRenderer::shutdown() {
+    if (!initialized_) return;
+
+    text_batch_.release();
+    if (grid_vertex_buffer_) {
+        glDeleteBuffers(1, &grid_vertex_buffer_);
+        grid_vertex_buffer_ = 0;
+    }
+    grid_vertices_.clear();
+    grid_buffer_allocated_ = false;
+
+    destroy_shader_program();
+    font_atlas_ = nullptr;
+    initialized_ = false;
+}
+
+// =============================================================================
+// PERSISTENT TEXT GRID
+// =============================================================================
+
+void TextRenderer::set_grid_layout(int cols, int rows, int origin_x, int origin_y,
+                                   int cell_width, int cell_height, int baseline) {
+    grid_cols_ = std::max(cols, 0);
+    grid_rows_ = std::max(rows, 0);
+    grid_origin_x_ = origin_x;
+    grid_origin_y_ = origin_y;
+    grid_cell_width_ = cell_width;
+    grid_cell_height_ = cell_height;
+    grid_baseline_ = baseline;
+
+    // Zeroed vertices are degenerate quads, i.e. empty cells
+    grid_vertices_.assign((size_t)grid_cols_ * grid_rows_ * VERTICES_PER_CELL, TextVertex());
+    grid_buffer_allocated_ = false;
+    grid_dirty_first_ = grid_vertices_.empty() ? -1 : 0;
+    grid_dirty_last_ = grid_cols_ * grid_rows_ - 1;
+    grid_first_row_ = 0;
+    grid_scroll_x_ = 0.0f;
+    grid_scroll_y_ = 0.0f;
+}
+
+void TextRenderer::set_grid_scroll(int first_row, float offset_x, float offset_y) {
+    grid_first_row_ = (grid_rows_ > 0) ? ((first_row % grid_rows_) + grid_rows_) % grid_rows_ : 0;
+    grid_scroll_x_ = offset_x;
+    grid_scroll_y_ = offset_y;
+}
+
+void TextRenderer::update_grid_cells(int row, int first_col, int count,
+                                     const uint32_t* codepoints,
+                                     const uint32_t* ink,
+                                     const uint32_t* paper) {
+    if (!initialized_ || row < 0 || row >= grid_rows_) return;
+    if (first_col < 0) {
+        codepoints -= first_col;
+        ink -= first_col;
+        paper -= first_col;
+        count += first_col;
+        first_col = 0;
+    }
+    count = std::min(count, grid_cols_ - first_col);
+    if (count <= 0) return;
+
+    float solid_u, solid_v;
+    font_atlas_->get_solid_texcoord(solid_u, solid_v);
+    const float atlas_w = (float)font_atlas_->get_atlas_width();
+    const float atlas_h = (float)font_atlas_->get_atlas_height();
+
+    for (int i = 0; i < count; i++) {
+        int col = first_col + i;
+        int cell_index = row * grid_cols_ + col;
+        TextVertex* cell = &grid_vertices_[(size_t)cell_index * VERTICES_PER_CELL];
+
+        float cell_x = (float)(grid_origin_x_ + col * grid_cell_width_);
+        float cell_y = (float)(grid_origin_y_ + row * grid_cell_height_);
+
+        // Paper quad (degenerate when transparent)
+        uint32_t paper_color = paper[i];
+        if ((paper_color & 0xFF) != 0) {
+            write_quad(cell, cell_x, cell_y, (float)grid_cell_width_, (float)grid_cell_height_,
+                       solid_u, solid_v, 0.0f, 0.0f, paper_color);
+        } else {
+            write_quad(cell, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+        }
+
+        // Glyph quad, clipped to the cell like the CPU raster path
+        TextVertex* glyph_quad = cell + 4;
+        write_quad(glyph_quad, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+        uint32_t codepoint = codepoints[i];
+        uint32_t ink_color = ink[i];
+        if (codepoint == 0x20 || codepoint == 0 || (ink_color & 0xFF) == 0) continue;
+
+        const CharacterMetrics* metrics = font_atlas_->get_or_load_character(codepoint);
+        if (!metrics || metrics->width <= 0 || metrics->height <= 0) continue;
+
+        // Glyph pixels sit inside a 1 pixel border in the atlas
+        float gx0 = cell_x + metrics->bearing_x;
+        float gy0 = cell_y + grid_baseline_ - metrics->bearing_y;
+        float gx1 = gx0 + metrics->width;
+        float gy1 = gy0 + metrics->height;
+        float u0 = metrics->tex_x + 1.0f / atlas_w;
+        float v0 = metrics->tex_y + 1.0f / atlas_h;
+
+        float cx0 = std::max(gx0, cell_x);
+        float cy0 = std::max(gy0, cell_y);
+        float cx1 = std::min(gx1, cell_x + grid_cell_width_);
+        float cy1 = std::min(gy1, cell_y + grid_cell_height_);
+        if (cx1 <= cx0 || cy1 <= cy0) continue;
+
+        write_quad(glyph_quad, cx0, cy0, cx1 - cx0, cy1 - cy0,
+                   u0 + (cx0 - gx0) / atlas_w, v0 + (cy0 - gy0) / atlas_h,
+                   (cx1 - cx0) / atlas_w, (cy1 - cy0) / atlas_h,
+                   ink_color);
+    }
+
+    int first_cell = row * grid_cols_ + first_col;
+    int last_cell = first_cell + count - 1;
+    if (grid_dirty_first_ < 0) {
+        grid_dirty_first_ = first_cell;
+        grid_dirty_last_ = last_cell;
+    } else {
+        grid_dirty_first_ = std::min(grid_dirty_first_, first_cell);
+        grid_dirty_last_ = std::max(grid_dirty_last_, last_cell);
+    }
+}
+
+void TextRenderer::render_grid(int screen_width, int screen_height) {
+    if (!initialized_ || grid_vertices_.empty()) return;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    glBindBuffer(GL_ARRAY_BUFFER, grid_vertex_buffer_);
+    if (!grid_buffer_allocated_) {
+        glBufferData(GL_ARRAY_BUFFER, grid_vertices_.size() * sizeof(TextVertex),
+                     grid_vertices_.data(), GL_DYNAMIC_DRAW);
+        grid_buffer_allocated_ = true;
+    } else if (grid_dirty_first_ >= 0) {
+        // Re-upload only the changed cell range
+        size_t offset = (size_t)grid_dirty_first_ * VERTICES_PER_CELL;
+        size_t count = (size_t)(grid_dirty_last_ - grid_dirty_first_ + 1) * VERTICES_PER_CELL;
+        glBufferSubData(GL_ARRAY_BUFFER, offset * sizeof(TextVertex),
+                        count * sizeof(TextVertex), &grid_vertices_[offset]);
+    }
+    grid_dirty_first_ = -1;
+    grid_dirty_last_ = -1;
+
+    begin_draw(grid_vertex_buffer_, screen_width, screen_height);
+
+    // Rows are stored as a ring: draw [first_row, rows) at the top of the
+    // grid, then [0, first_row) below it, each shifted by a uniform offset
+    GLint row_vertices = grid_cols_ * VERTICES_PER_CELL;
+    float row_height = (float)grid_cell_height_;
+    int tail_rows = grid_rows_ - grid_first_row_;
+
+    glUniform2f(uniform_offset_, grid_scroll_x_, grid_scroll_y_ - grid_first_row_ * row_height);
+    glDrawArrays(GL_QUADS, grid_first_row_ * row_vertices, tail_rows * row_vertices);
+    if (grid_first_row_ > 0) {
+        glUniform2f(uniform_offset_, grid_scroll_x_, grid_scroll_y_ + tail_rows * row_height);
+        glDrawArrays(GL_QUADS, 0, grid_first_row_ * row_vertices);
+    }
+
+    end_draw();
+
+    characters_rendered_ = grid_cols_ * grid_rows_;
+    last_render_time_ms_ = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - start).count();
+
+    if (debug_mode_) {
+        std::cout << "TextRenderer: grid " << grid_cols_ << "x" << grid_rows_
+                  << " in " << last_render_time_ms_ << "ms" << std::endl;
+    }
+}
+
+// =============================================================================
+// IMMEDIATE TEXT RENDERING
+// =============================================================================
+
+void TextRenderer::render_text_layer(const TextData& text_data,
+                                     const ViewportOffset& viewport_offset,
+                                     int screen_width, int screen_height) {
+    if (!initialized_) return;
+
+    setup_projection_matrix(screen_width, screen_height);
+    begin_text_batch();
+
+    int char_width = get_char_width();
+    int line_height = get_line_height();
+
+    for (int row = 0; row < text_data.rows; row++) {
+        for (int col = 0; col < text_data.cols; col++) {
+            size_t index = (size_t)row * text_data.cols + col;
+            if (index >= text_data.characters.size()) break;
+
+            uint32_t codepoint = (unsigned char)text_data.characters[index];
+            if (codepoint == 0 || codepoint == 0x20) continue;
+
+            uint32_t color = index < text_data.colors.size() ? text_data.colors[index]
+                                                             : text_data.current_color;
+            int x = col * char_width - viewport_offset.x;
+            int y = row * line_height - viewport_offset.y;
+            add_character_to_batch(codepoint, x, y, color, 1.0f);
+        }
+    }
+
+    flush_text_batch();
+    render_cursor();
+}
+
+void TextRenderer::render_text_string(const char* text, int x, int y,
+                                      uint32_t color, float scale) {
+    if (!initialized_ || !text) return;
+
+    begin_text_batch();
+
+    int pen_x = x;
+    int pen_y = y;
+    for (const char* p = text; *p; p++) {
+        if (*p == '\n') {
+            pen_x = x;
+            pen_y += (int)(get_line_height() * scale);
+            continue;
+        }
+
+        uint32_t codepoint = (unsigned char)*p;
+        const CharacterMetrics* metrics = font_atlas_->get_or_load_character(codepoint);
+        if (codepoint != 0x20) {
+            add_character_to_batch(codepoint, pen_x, pen_y, color, scale);
+        }
+        pen_x += (int)((metrics ? metrics->advance : get_char_width()) * scale);
+    }
+
+    flush_text_batch();
+}
+
+void TextRenderer::render_text_with_background(const char* text, int x, int y,
+                                               uint32_t text_color, uint32_t bg_color,
+                                               float scale) {
+    if (!initialized_ || !text) return;
+
+    int width, height;
+    measure_text(text, width, height, scale);
+
+    float solid_u, solid_v;
+    font_atlas_->get_solid_texcoord(solid_u, solid_v);
+
+    begin_text_batch();
+    add_quad_to_batch((float)x, (float)y, (float)width, (float)height,
+                      solid_u, solid_v, 0.0f, 0.0f, bg_color);
+    flush_text_batch();
+
+    render_text_string(text, x, y, text_color, scale);
+}
+
+void TextRenderer::measure_text(const char* text, int& width, int& height, float scale) {
+    width = 0;
+    height = 0;
+    if (!font_atlas_) return;
+
+    font_atlas_->measure_text(text, width, height);
+    width = (int)(width * scale);
+    height = (int)(height * scale);
+}
+
+void TextRenderer::render_text_at_grid(const char* text, int grid_x, int grid_y,
+                                       uint32_t color) {
+    int screen_x, screen_y;
+    grid_to_screen(grid_x, grid_y, screen_x, screen_y);
+    render_text_string(text, screen_x, screen_y, color, 1.0f);
+}
+
+// =============================================================================
+// PROPERTIES
+// =============================================================================
+
+void TextRenderer::set_blend_mode(bool enable_alpha_blend) {
+    alpha_blend_enabled_ = enable_alpha_blend;
+}
+
+void TextRenderer::set_cursor_visible(bool visible) {
+    cursor_visible_ = visible;
+}
+
+void TextRenderer::set_cursor_position(int x, int y) {
+    cursor_x_ = x;
+    cursor_y_ = y;
+}
+
+void TextRenderer::set_cursor_color(uint32_t color) {
+    cursor_color_ = color;
+}
+
+void TextRenderer::set_cursor_blink_rate(int milliseconds) {
+    cursor_blink_rate_ms_ = milliseconds;
+}
+
+int TextRenderer::get_char_width() const {
+    if (grid_cell_width_ > 0) return grid_cell_width_;
+    return font_atlas_ ? font_atlas_->get_char_width() : 0;
+}
+
+int TextRenderer::get_char_height() const {
+    return font_atlas_ ? font_atlas_->get_char_height() : 0;
+}
+
+int TextRenderer::get_line_height() const {
+    if (grid_cell_height_ > 0) return grid_cell_height_;
+    return font_atlas_ ? font_atlas_->get_line_height() : 0;
+}
+
+int TextRenderer::get_grid_cols(int screen_width) const {
+    int char_width = get_char_width();
+    return char_width > 0 ? screen_width / char_width : 0;
+}
+
+int TextRenderer::get_grid_rows(int screen_height) const {
+    int line_height = get_line_height();
+    return line_height > 0 ? screen_height / line_height : 0;
+}
+
+void TextRenderer::set_debug_mode(bool enable) {
+    debug_mode_ = enable;
+}
+
+// =============================================================================
+// SHADER MANAGEMENT
+// =============================================================================
+
+bool TextRenderer::create_shader_program() {
+    GLuint vertex_shader = 0;
+    GLuint fragment_shader = 0;
+
+    if (!compile_shader(GL_VERTEX_SHADER, vertex_shader_source_, vertex_shader)) {
+        return false;
+    }
+    if (!compile_shader(GL_FRAGMENT_SHADER, fragment_shader_source_, fragment_shader)) {
+        glDeleteShader(vertex_shader);
+        return false;
+    }
+
+    bool linked = link_program(vertex_shader, fragment_shader);
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+    if (!linked) {
+        return false;
+    }
+
+    attrib_position_ = glGetAttribLocation(shader_program_, "a_position");
+    attrib_texcoord_ = glGetAttribLocation(shader_program_, "a_texcoord");
+    attrib_color_ = glGetAttribLocation(shader_program_, "a_color");
+    uniform_projection_ = glGetUniformLocation(shader_program_, "u_projection");
+    uniform_texture_ = glGetUniformLocation(shader_program_, "u_texture");
+    uniform_color_ = glGetUniformLocation(shader_program_, "u_color");
+    uniform_offset_ = glGetUniformLocation(shader_program_, "u_offset");
+
+    return attrib_position_ >= 0 && attrib_texcoord_ >= 0 && attrib_color_ >= 0;
+}
+
+bool TextRenderer::compile_shader(GLenum type, const char* source, GLuint& shader) {
+    shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[512];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        std::cerr << "TextRenderer: shader compile error: " << log << std::endl;
+        glDeleteShader(shader);
+        shader = 0;
+        return false;
+    }
+    return true;
+}
+
+bool TextRenderer::link_program(GLuint vertex_shader, GLuint fragment_shader) {
+    shader_program_ = glCreateProgram();
+    glAttachShader(shader_program_, vertex_shader);
+    glAttachShader(shader_program_, fragment_shader);
+    glLinkProgram(shader_program_);
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[512];
+        glGetProgramInfoLog(shader_program_, sizeof(log), nullptr, log);
+        std::cerr << "TextRenderer: shader link error: " << log << std::endl;
+        destroy_shader_program();
+        return false;
+    }
+    return true;
+}
+
+void TextRenderer::destroy_shader_program() {
+    if (shader_program_) {
+        glDeleteProgram(shader_program_);
+        shader_program_ = 0;
+    }
+}
+
+// =============================================================================
+// DRAW HELPERS
+// =============================================================================
+
+void TextRenderer::begin_draw(GLuint vertex_buffer, int screen_width, int screen_height) {
+    setup_projection_matrix(screen_width, screen_height);
+
+    glUseProgram(shader_program_);
+    glUniformMatrix4fv(uniform_projection_, 1, GL_FALSE, projection_matrix_);
+    glUniform1i(uniform_texture_, 0);
+    glUniform4f(uniform_color_, 1.0f, 1.0f, 1.0f, 1.0f);
+    glUniform2f(uniform_offset_, 0.0f, 0.0f);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, font_atlas_->get_texture_id());
+
+    if (alpha_blend_enabled_) {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+    glEnableVertexAttribArray(attrib_position_);
+    glEnableVertexAttribArray(attrib_texcoord_);
+    glEnableVertexAttribArray(attrib_color_);
+    glVertexAttribPointer(attrib_position_, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex),
+                          (const void*)offsetof(TextVertex, x));
+    glVertexAttribPointer(attrib_texcoord_, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex),
+                          (const void*)offsetof(TextVertex, tex_x));
+    glVertexAttribPointer(attrib_color_, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(TextVertex),
+                          (const void*)offsetof(TextVertex, color));
+}
+
+void TextRenderer::end_draw() {
+    glDisableVertexAttribArray(attrib_position_);
+    glDisableVertexAttribArray(attrib_texcoord_);
+    glDisableVertexAttribArray(attrib_color_);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_BLEND);
+}
+
+void TextRenderer::begin_text_batch() {
+    text_batch_.clear();
+}
+
+void TextRenderer::add_character_to_batch(uint32_t codepoint, int x, int y,
+                                          uint32_t color, float scale) {
+    const CharacterMetrics* metrics = font_atlas_->get_or_load_character(codepoint);
+    if (!metrics) return;
+
+    // Quad includes the 1 pixel atlas border around the glyph
+    float baseline = (float)font_atlas_->get_baseline();
+    float qx = x + (metrics->bearing_x - 1) * scale;
+    float qy = y + (baseline - metrics->bearing_y - 1) * scale;
+    float qw = (metrics->width + 2) * scale;
+    float qh = (metrics->height + 2) * scale;
+
+    add_quad_to_batch(qx, qy, qw, qh, metrics->tex_x, metrics->tex_y,
+                      metrics->tex_w, metrics->tex_h, color);
+}
+
+void TextRenderer::add_quad_to_batch(float x, float y, float w, float h,
+                                     float tex_x, float tex_y, float tex_w, float tex_h,
+                                     uint32_t color) {
+    if (text_batch_.character_count >= MAX_CHARACTERS_PER_BATCH) {
+        flush_text_batch();
+    }
+
+    size_t base = text_batch_.vertices.size();
+    text_batch_.vertices.resize(base + 4);
+    write_quad(&text_batch_.vertices[base], x, y, w, h, tex_x, tex_y, tex_w, tex_h, color);
+    text_batch_.character_count++;
+}
+
+void TextRenderer::flush_text_batch() {
+    if (text_batch_.vertices.empty()) return;
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    text_batch_.upload_to_gpu();
+    begin_draw(text_batch_.vertex_buffer, viewport[2], viewport[3]);
+    glDrawArrays(GL_QUADS, 0, (GLsizei)text_batch_.vertices.size());
+    end_draw();
+
+    characters_rendered_ = text_batch_.character_count;
+    text_batch_.clear();
+}
+
+void TextRenderer::write_quad(TextVertex* quad, float x, float y, float w, float h,
+                              float tex_x, float tex_y, float tex_w, float tex_h,
+                              uint32_t color) {
+    uint32_t vertex_color = to_vertex_color(color);
+
+    quad[0] = {x,     y,     tex_x,         tex_y,         vertex_color};
+    quad[1] = {x + w, y,     tex_x + tex_w, tex_y,         vertex_color};
+    quad[2] = {x + w, y + h, tex_x + tex_w, tex_y + tex_h, vertex_color};
+    quad[3] = {x,     y + h, tex_x,         tex_y + tex_h, vertex_color};
+}
+
+void TextRenderer::grid_to_screen(int grid_x, int grid_y, int& screen_x, int& screen_y) {
+    screen_x = grid_origin_x_ + grid_x * get_char_width();
+    screen_y = grid_origin_y_ + grid_y * get_line_height();
+}
+
+// =============================================================================
+// CURSOR
+// =============================================================================
+
+void TextRenderer::render_cursor() {
+    if (!cursor_visible_ || !should_cursor_blink()) return;
+
+    float solid_u, solid_v;
+    font_atlas_->get_solid_texcoord(solid_u, solid_v);
+
+    int x, y;
+    grid_to_screen(cursor_x_, cursor_y_, x, y);
+
+    // Underscore just below the baseline
+    begin_text_batch();
+    add_quad_to_batch((float)x, (float)(y + font_atlas_->get_baseline() + 2),
+                      (float)get_char_width(), 3.0f,
+                      solid_u, solid_v, 0.0f, 0.0f, cursor_color_);
+    flush_text_batch();
+}
+
+bool TextRenderer::should_cursor_blink() {
+    if (cursor_blink_rate_ms_ <= 0) return true;
+
+    uint64_t now = get_time_ms();
+    if (now - cursor_last_blink_time_ >= (uint64_t)cursor_blink_rate_ms_) {
+        cursor_blink_state_ = !cursor_blink_state_;
+        cursor_last_blink_time_ = now;
+    }
+    return cursor_blink_state_;
+}
+
+// =============================================================================
+// UTILITIES
+// =============================================================================
+
+uint64_t TextRenderer::get_time_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void TextRenderer::setup_projection_matrix(int screen_width, int screen_height) {
+    // Column-major orthographic projection, origin top-left, Y down
+    memset(projection_matrix_, 0, sizeof(projection_matrix_));
+    projection_matrix_[0] = 2.0f / screen_width;
+    projection_matrix_[5] = -2.0f / screen_height;
+    projection_matrix_[10] = -1.0f;
+    projection_matrix_[12] = -1.0f;
+    projection_matrix_[13] = 1.0f;
+    projection_matrix_[15] = 1.0f;
+}
+
+uint32_t TextRenderer::to_vertex_color(uint32_t rgba) {
+    // Runtime colors are 0xRRGGBBAA; vertex attributes read bytes in memory order
+    uint8_t bytes[4] = {
+        (uint8_t)(rgba >> 24),
+        (uint8_t)(rgba >> 16),
+        (uint8_t)(rgba >> 8),
+        (uint8_t)rgba
+    };
+    uint32_t packed;
+    memcpy(&packed, bytes, sizeof(packed));
+    return packed;
+}
+
+// =============================================================================
+// GLOBAL FUNCTIONS
+// =============================================================================
+
+bool initialize_text_renderer(FontAtlas* font_atlas) {
+    g_text_renderer = std::make_unique<TextRenderer>();
+    if (!g_text_renderer->initialize(font_atlas)) {
+        g_text_renderer.reset();
+        return false;
+    }
+    return true;
+}
+
+void shutdown_text_renderer() {
+    g_text_renderer.reset();
+}
+
+TextRenderer* get_text_renderer() {
+    return g_text_renderer.get();
+}
+
+} // namespace AbstractRuntime
@@ -295,8 +295,8 @@ void TileLayer::render_tile(int grid_x, int grid_y, int tile_id) {
     }
     
     // Get tile texture info from sprite bank
-    GLuint texture = tile_bank_->get_texture(tile_id);
-    if (texture == 0) {
+    SpriteRegion region;
+    if (!tile_bank_->get_sprite_region(tile_id, region) || region.texture_id == 0) {
         return;  // Texture not loaded
     }
     
@@ -308,15 +308,15 @@ void TileLayer::render_tile(int grid_x, int grid_y, int tile_id) {
     float screen_x = world_x;
     float screen_y = world_y;
     
-    // Bind texture
-    glBindTexture(GL_TEXTURE_2D, texture);
+    // Bind the atlas page holding the tile
+    glBindTexture(GL_TEXTURE_2D, region.texture_id);
     
     // Draw tile as a textured quad
     glBegin(GL_QUADS);
-    glTexCoord2f(0.0f, 0.0f); glVertex2f(screen_x, screen_y);
-    glTexCoord2f(1.0f, 0.0f); glVertex2f(screen_x + TILE_SIZE, screen_y);
-    glTexCoord2f(1.0f, 1.0f); glVertex2f(screen_x + TILE_SIZE, screen_y + TILE_SIZE);
-    glTexCoord2f(0.0f, 1.0f); glVertex2f(screen_x, screen_y + TILE_SIZE);
+    glTexCoord2f(region.u0, region.v0); glVertex2f(screen_x, screen_y);
+    glTexCoord2f(region.u1, region.v0); glVertex2f(screen_x + TILE_SIZE, screen_y);
+    glTexCoord2f(region.u1, region.v1); glVertex2f(screen_x + TILE_SIZE, screen_y + TILE_SIZE);
+    glTexCoord2f(region.u0, region.v1); glVertex2f(screen_x, screen_y + TILE_SIZE);
     glEnd();
 }
 
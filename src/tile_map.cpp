@@ -0,0 +1,819 @@
+#include "tile_map.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AbstractRuntime {
+
+const TileMap::Chunk TileMap::zero_chunk_ = {};
+
+// Chunk coordinate of a tile index (floor division, maps are never negative
+// but callers may pass positions left of or above the map)
+static int chunk_of(int tile) {
+    return tile >= 0 ? tile / TileMap::CHUNK_SIZE
+                     : -((-tile + TileMap::CHUNK_SIZE - 1) / TileMap::CHUNK_SIZE);
+}
+
+// =============================================================================
+// LIFECYCLE
+// =============================================================================
+
+TileMap::TileMap()
+    : width_(0)
+    , height_(0)
+    , backing_(nullptr)
+    , backing_end_(0)
+    , cached_key_(0)
+    , cached_chunk_(nullptr) {
+}
+
+TileMap::~TileMap() {
+    release();
+}
+
+void TileMap::reset(int width, int height) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    drop_all_chunks();
+    width_ = std::max(0, width);
+    height_ = std::max(0, height);
+}
+
+void TileMap::release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    drop_all_chunks();
+    width_ = 0;
+    height_ = 0;
+    if (backing_) {
+        fclose(backing_);
+        backing_ = nullptr;
+    }
+    backing_path_.clear();
+    backing_end_ = 0;
+}
+
+void TileMap::drop_all_chunks() {
+    for (auto& entry : chunks_) {
+        if (!is_mapped_chunk(entry.second)) {
+            delete entry.second;
+        }
+    }
+    chunks_.clear();
+    file_chunks_.clear();
+    mapped_file_.reset();
+    evicted_.clear();
+    file_slots_.clear();
+    backing_end_ = 0;
+    cached_key_ = 0;
+    cached_chunk_ = nullptr;
+}
+
+// =============================================================================
+// TILE ACCESS
+// =============================================================================
+
+const TileMap::Chunk* TileMap::find_chunk(int chunk_x, int chunk_y) const {
+    uint64_t key = chunk_key(chunk_x, chunk_y);
+    if (cached_chunk_ && cached_key_ == key) {
+        return cached_chunk_;
+    }
+
+    Chunk* chunk = nullptr;
+    auto it = chunks_.find(key);
+    if (it != chunks_.end()) {
+        chunk = it->second;
+    } else if (evicted_.count(key)) {
+        chunk = load_evicted_chunk(key);
+    } else if (file_chunks_.count(key)) {
+        chunk = load_file_chunk(key);
+    }
+
+    if (!chunk) {
+        return &zero_chunk_;
+    }
+
+    cached_key_ = key;
+    cached_chunk_ = chunk;
+    return chunk;
+}
+
+TileMap::Chunk* TileMap::get_or_create_chunk(int chunk_x, int chunk_y) {
+    const Chunk* found = find_chunk(chunk_x, chunk_y);
+    if (found != &zero_chunk_) {
+        return const_cast<Chunk*>(found);
+    }
+
+    Chunk* chunk = new Chunk();
+    uint64_t key = chunk_key(chunk_x, chunk_y);
+    chunks_[key] = chunk;
+    cached_key_ = key;
+    cached_chunk_ = chunk;
+    return chunk;
+}
+
+int TileMap::get(int x, int y) const {
+    if (x < 0 || x >= width_ || y < 0 || y >= height_) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Chunk* chunk = find_chunk(x / CHUNK_SIZE, y / CHUNK_SIZE);
+    return chunk->tiles[(y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE)];
+}
+
+void TileMap::set(int x, int y, int cell) {
+    if (x < 0 || x >= width_ || y < 0 || y >= height_) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    int chunk_x = x / CHUNK_SIZE;
+    int chunk_y = y / CHUNK_SIZE;
+    int index = (y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE);
+
+    // Writing zero into an unwritten chunk changes nothing
+    uint16_t value = (uint16_t)cell;
+    const Chunk* found = find_chunk(chunk_x, chunk_y);
+    if (found == &zero_chunk_ && value == 0) {
+        return;
+    }
+
+    get_or_create_chunk(chunk_x, chunk_y)->tiles[index] = value;
+}
+
+void TileMap::fill(int x, int y, int width, int height, int cell) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    fill_unlocked(x, y, width, height, cell);
+}
+
+void TileMap::fill_unlocked(int x, int y, int width, int height, int cell) {
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + width, width_);
+    int y1 = std::min(y + height, height_);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    uint16_t value = (uint16_t)cell;
+    for (int chunk_y = y0 / CHUNK_SIZE; chunk_y <= (y1 - 1) / CHUNK_SIZE; chunk_y++) {
+        for (int chunk_x = x0 / CHUNK_SIZE; chunk_x <= (x1 - 1) / CHUNK_SIZE; chunk_x++) {
+            // Zero fills leave unwritten chunks unallocated
+            const Chunk* found = find_chunk(chunk_x, chunk_y);
+            if (found == &zero_chunk_ && value == 0) {
+                continue;
+            }
+
+            Chunk* chunk = get_or_create_chunk(chunk_x, chunk_y);
+            int left = std::max(x0, chunk_x * CHUNK_SIZE) - chunk_x * CHUNK_SIZE;
+            int right = std::min(x1, (chunk_x + 1) * CHUNK_SIZE) - chunk_x * CHUNK_SIZE;
+            int top = std::max(y0, chunk_y * CHUNK_SIZE) - chunk_y * CHUNK_SIZE;
+            int bottom = std::min(y1, (chunk_y + 1) * CHUNK_SIZE) - chunk_y * CHUNK_SIZE;
+
+            for (int row = top; row < bottom; row++) {
+                uint16_t* tiles = &chunk->tiles[row * CHUNK_SIZE];
+                std::fill(tiles + left, tiles + right, value);
+            }
+        }
+    }
+}
+
+void TileMap::read_rect(int x, int y, int width, int height, uint16_t* out) const {
+    if (!out || width <= 0 || height <= 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    read_rect_unlocked(x, y, width, height, out);
+}
+
+void TileMap::read_rect_unlocked(int x, int y, int width, int height, uint16_t* out) const {
+    for (int row = 0; row < height; row++) {
+        int map_y = y + row;
+        uint16_t* dest = out + (size_t)row * width;
+
+        if (map_y < 0 || map_y >= height_) {
+            std::fill(dest, dest + width, 0);
+            continue;
+        }
+
+        // Copy the row one chunk segment at a time
+        int col = 0;
+        while (col < width) {
+            int map_x = x + col;
+            if (map_x < 0 || map_x >= width_) {
+                dest[col++] = 0;
+                continue;
+            }
+
+            int chunk_x = map_x / CHUNK_SIZE;
+            int offset_x = map_x % CHUNK_SIZE;
+            int run = std::min(CHUNK_SIZE - offset_x, std::min(width - col, width_ - map_x));
+            const Chunk* chunk = find_chunk(chunk_x, map_y / CHUNK_SIZE);
+            const uint16_t* src = &chunk->tiles[(map_y % CHUNK_SIZE) * CHUNK_SIZE + offset_x];
+            std::copy(src, src + run, dest + col);
+            col += run;
+        }
+    }
+}
+
+void TileMap::write_rect(int x, int y, int width, int height, const uint16_t* cells) {
+    if (!cells || width <= 0 || height <= 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    write_rect_unlocked(x, y, width, height, cells);
+}
+
+void TileMap::write_rect_unlocked(int x, int y, int width, int height, const uint16_t* cells) {
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + width, width_);
+    int y1 = std::min(y + height, height_);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    for (int chunk_y = y0 / CHUNK_SIZE; chunk_y <= (y1 - 1) / CHUNK_SIZE; chunk_y++) {
+        for (int chunk_x = x0 / CHUNK_SIZE; chunk_x <= (x1 - 1) / CHUNK_SIZE; chunk_x++) {
+            int left = std::max(x0, chunk_x * CHUNK_SIZE);
+            int right = std::min(x1, (chunk_x + 1) * CHUNK_SIZE);
+            int top = std::max(y0, chunk_y * CHUNK_SIZE);
+            int bottom = std::min(y1, (chunk_y + 1) * CHUNK_SIZE);
+
+            // All-zero segments leave unwritten chunks unallocated
+            if (find_chunk(chunk_x, chunk_y) == &zero_chunk_) {
+                bool empty = true;
+                for (int map_y = top; map_y < bottom && empty; map_y++) {
+                    const uint16_t* src = cells + (size_t)(map_y - y) * width + (left - x);
+                    empty = std::all_of(src, src + (right - left), [](uint16_t cell) { return cell == 0; });
+                }
+                if (empty) {
+                    continue;
+                }
+            }
+
+            Chunk* chunk = get_or_create_chunk(chunk_x, chunk_y);
+            for (int map_y = top; map_y < bottom; map_y++) {
+                const uint16_t* src = cells + (size_t)(map_y - y) * width + (left - x);
+                uint16_t* dest = &chunk->tiles[(map_y - chunk_y * CHUNK_SIZE) * CHUNK_SIZE +
+                                               (left - chunk_x * CHUNK_SIZE)];
+                std::copy(src, src + (right - left), dest);
+            }
+        }
+    }
+}
+
+void TileMap::copy_rect(int src_x, int src_y, int width, int height, int dest_x, int dest_y, bool move) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    // Staging through a buffer makes overlapping copies safe in any direction
+    std::vector<uint16_t> cells((size_t)width * height);
+    std::lock_guard<std::mutex> lock(mutex_);
+    read_rect_unlocked(src_x, src_y, width, height, cells.data());
+    if (move) {
+        fill_unlocked(src_x, src_y, width, height, 0);
+    }
+    write_rect_unlocked(dest_x, dest_y, width, height, cells.data());
+}
+
+void TileMap::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    drop_all_chunks();
+}
+
+// =============================================================================
+// EVICTION
+// =============================================================================
+
+bool TileMap::set_backing_file(const char* path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Evicted chunks live only in the old file; bring them back first
+    std::vector<uint64_t> keys;
+    for (const auto& entry : evicted_) {
+        keys.push_back(entry.first);
+    }
+    for (uint64_t key : keys) {
+        load_evicted_chunk(key);
+    }
+
+    if (backing_) {
+        fclose(backing_);
+        backing_ = nullptr;
+    }
+    file_slots_.clear();
+    backing_end_ = 0;
+    backing_path_.clear();
+
+    if (!path || !*path) {
+        return true;
+    }
+
+    backing_ = fopen(path, "w+b");
+    if (!backing_) {
+        std::cerr << "[Runtime] Failed to open tile map backing file: " << path << std::endl;
+        return false;
+    }
+
+    backing_path_ = path;
+    return true;
+}
+
+TileMap::Chunk* TileMap::load_evicted_chunk(uint64_t key) const {
+    auto it = evicted_.find(key);
+    if (it == evicted_.end() || !backing_) {
+        return nullptr;
+    }
+
+    Chunk* chunk = new Chunk();
+    if (fseek(backing_, it->second, SEEK_SET) != 0 ||
+        fread(chunk->tiles, sizeof(chunk->tiles), 1, backing_) != 1) {
+        std::cerr << "[Runtime] Failed to read evicted tile chunk from " << backing_path_ << std::endl;
+        memset(chunk->tiles, 0, sizeof(chunk->tiles));
+    }
+
+    evicted_.erase(it);
+    chunks_[key] = chunk;
+    return chunk;
+}
+
+int TileMap::evict_outside(int center_x, int center_y, int radius) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!backing_ || radius < 0) {
+        return 0;
+    }
+
+    int center_chunk_x = chunk_of(center_x);
+    int center_chunk_y = chunk_of(center_y);
+    int evicted = 0;
+
+    for (auto it = chunks_.begin(); it != chunks_.end(); ) {
+        int chunk_x = (int)(uint32_t)(it->first & 0xFFFFFFFFu);
+        int chunk_y = (int)(uint32_t)(it->first >> 32);
+        if (std::abs(chunk_x - center_chunk_x) <= radius &&
+            std::abs(chunk_y - center_chunk_y) <= radius) {
+            ++it;
+            continue;
+        }
+
+        // Mapped chunks are already file backed; the kernel pages them out
+        Chunk* chunk = it->second;
+        if (is_mapped_chunk(chunk)) {
+            ++it;
+            continue;
+        }
+
+        bool empty = std::all_of(chunk->tiles, chunk->tiles + CHUNK_TILES,
+                                 [](uint16_t tile) { return tile == 0; });
+
+        if (!empty) {
+            // Reuse the chunk's file slot from an earlier eviction
+            long offset;
+            auto slot = file_slots_.find(it->first);
+            if (slot != file_slots_.end()) {
+                offset = slot->second;
+            } else {
+                offset = backing_end_;
+                backing_end_ += (long)sizeof(chunk->tiles);
+                file_slots_[it->first] = offset;
+            }
+
+            if (fseek(backing_, offset, SEEK_SET) != 0 ||
+                fwrite(chunk->tiles, sizeof(chunk->tiles), 1, backing_) != 1) {
+                std::cerr << "[Runtime] Failed to write tile chunk to " << backing_path_ << std::endl;
+                ++it;
+                continue;
+            }
+            evicted_[it->first] = offset;
+        }
+
+        if (cached_chunk_ == chunk) {
+            cached_chunk_ = nullptr;
+        }
+        delete chunk;
+        it = chunks_.erase(it);
+        evicted++;
+    }
+
+    if (evicted > 0) {
+        fflush(backing_);
+    }
+    return evicted;
+}
+
+// =============================================================================
+// MAP FILE CHUNKS
+// =============================================================================
+
+void TileMap::attach_file_chunks(int width, int height, std::shared_ptr<MappedMapFile> file,
+                                 const std::vector<FileChunk>& chunks) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    drop_all_chunks();
+    width_ = std::max(0, width);
+    height_ = std::max(0, height);
+    mapped_file_ = file;
+
+    for (const FileChunk& chunk : chunks) {
+        file_chunks_[chunk_key(chunk.chunk_x, chunk.chunk_y)] = chunk;
+    }
+}
+
+TileMap::Chunk* TileMap::load_file_chunk(uint64_t key) const {
+    auto it = file_chunks_.find(key);
+    if (it == file_chunks_.end()) {
+        return nullptr;
+    }
+
+    const FileChunk& source = it->second;
+    Chunk* chunk = nullptr;
+
+    if (source.encoding == CHUNK_RAW) {
+        // Use the mapped pages in place (private mapping, writes are copy-on-write)
+        chunk = reinterpret_cast<Chunk*>(const_cast<unsigned char*>(source.data));
+    } else {
+        chunk = new Chunk();
+        const unsigned char* run = source.data;
+        const unsigned char* end = source.data + source.size;
+        int filled = 0;
+        while (run + 4 <= end && filled < CHUNK_TILES) {
+            uint16_t count;
+            uint16_t tile;
+            memcpy(&count, run, sizeof(count));
+            memcpy(&tile, run + 2, sizeof(tile));
+            run += 4;
+
+            int length = std::min((int)count, CHUNK_TILES - filled);
+            std::fill(chunk->tiles + filled, chunk->tiles + filled + length, tile);
+            filled += length;
+        }
+
+        if (filled != CHUNK_TILES) {
+            std::cerr << "[Runtime] Corrupt RLE tile chunk in map file" << std::endl;
+            std::fill(chunk->tiles + filled, chunk->tiles + CHUNK_TILES, 0);
+        }
+    }
+
+    file_chunks_.erase(it);
+    chunks_[key] = chunk;
+    return chunk;
+}
+
+void TileMap::for_each_chunk(const std::function<void(int chunk_x, int chunk_y, const uint16_t* cells)>& visit) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Bring every chunk into memory so the visitor sees one directory
+    std::vector<uint64_t> keys;
+    for (const auto& entry : evicted_) {
+        keys.push_back(entry.first);
+    }
+    for (uint64_t key : keys) {
+        load_evicted_chunk(key);
+    }
+    keys.clear();
+    for (const auto& entry : file_chunks_) {
+        keys.push_back(entry.first);
+    }
+    for (uint64_t key : keys) {
+        load_file_chunk(key);
+    }
+
+    for (const auto& entry : chunks_) {
+        int chunk_x = (int)(uint32_t)(entry.first & 0xFFFFFFFFu);
+        int chunk_y = (int)(uint32_t)(entry.first >> 32);
+        visit(chunk_x, chunk_y, entry.second->tiles);
+    }
+}
+
+int TileMap::get_resident_chunk_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int)chunks_.size();
+}
+
+int TileMap::get_evicted_chunk_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int)evicted_.size();
+}
+
+// =============================================================================
+// MAPPED MAP FILE
+// =============================================================================
+
+MappedMapFile::MappedMapFile()
+    : data_(nullptr)
+    , size_(0) {
+}
+
+MappedMapFile::~MappedMapFile() {
+    if (data_) {
+        munmap(data_, size_);
+    }
+}
+
+bool MappedMapFile::open(const char* path) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "[Runtime] Failed to open map file: " << path << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        std::cerr << "[Runtime] Map file is empty or unreadable: " << path << std::endl;
+        close(fd);
+        return false;
+    }
+
+    // Private writable mapping: tiles can be edited in place without
+    // touching the file
+    void* mapping = mmap(nullptr, (size_t)info.st_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "[Runtime] Failed to map file: " << path << std::endl;
+        return false;
+    }
+
+    data_ = static_cast<unsigned char*>(mapping);
+    size_ = (size_t)info.st_size;
+    return true;
+}
+
+// =============================================================================
+// MAP FILE LOAD / SAVE
+// =============================================================================
+
+namespace {
+
+const char MAP_FILE_MAGIC[4] = { 'A', 'R', 'M', 'P' };
+const uint32_t MAP_FILE_VERSION = 3;  // 16-bit cells, variable layer count
+const long MAP_FILE_ALIGN = 64;
+
+struct MapFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t layer_count;
+    uint32_t chunk_size;
+};
+
+struct MapFileLayer {
+    uint32_t width;
+    uint32_t height;
+    uint32_t chunk_count;
+    uint32_t reserved;
+    uint64_t directory_offset;
+};
+
+struct MapFileChunkEntry {
+    int32_t chunk_x;
+    int32_t chunk_y;
+    uint32_t encoding;
+    uint32_t size;
+    uint64_t offset;
+};
+
+static_assert(sizeof(MapFileHeader) == 16, "map file header layout");
+static_assert(sizeof(MapFileLayer) == 24, "map file layer layout");
+static_assert(sizeof(MapFileChunkEntry) == 24, "map file chunk entry layout");
+
+const size_t RAW_CHUNK_BYTES = TileMap::CHUNK_TILES * sizeof(uint16_t);
+
+// Read a layer's chunk directory, validating every payload against the file
+bool read_layer_directory(const MappedMapFile& file, const MapFileLayer& layer,
+                          std::vector<TileMap::FileChunk>& chunks) {
+    uint64_t directory_size = (uint64_t)layer.chunk_count * sizeof(MapFileChunkEntry);
+    if (layer.directory_offset > file.size() ||
+        directory_size > file.size() - layer.directory_offset) {
+        return false;
+    }
+
+    const unsigned char* directory = file.data() + layer.directory_offset;
+    chunks.reserve(layer.chunk_count);
+    for (uint32_t i = 0; i < layer.chunk_count; i++) {
+        MapFileChunkEntry entry;
+        memcpy(&entry, directory + i * sizeof(MapFileChunkEntry), sizeof(entry));
+
+        if (entry.offset > file.size() || entry.size > file.size() - entry.offset) {
+            return false;
+        }
+        if (entry.encoding == TileMap::CHUNK_RAW) {
+            if (entry.size != RAW_CHUNK_BYTES || entry.offset % alignof(uint16_t) != 0) {
+                return false;
+            }
+        } else if (entry.encoding != TileMap::CHUNK_RLE) {
+            return false;
+        }
+
+        TileMap::FileChunk chunk;
+        chunk.chunk_x = entry.chunk_x;
+        chunk.chunk_y = entry.chunk_y;
+        chunk.encoding = entry.encoding;
+        chunk.data = file.data() + entry.offset;
+        chunk.size = entry.size;
+        chunks.push_back(chunk);
+    }
+    return true;
+}
+
+// Encode a chunk as (count, cell) runs
+void encode_chunk_rle(const uint16_t* tiles, std::vector<unsigned char>& out) {
+    out.clear();
+    int index = 0;
+    while (index < TileMap::CHUNK_TILES) {
+        uint16_t tile = tiles[index];
+        uint16_t count = 1;
+        while (index + count < TileMap::CHUNK_TILES && tiles[index + count] == tile) {
+            count++;
+        }
+
+        unsigned char run[4];
+        memcpy(run, &count, sizeof(count));
+        memcpy(run + 2, &tile, sizeof(tile));
+        out.insert(out.end(), run, run + 4);
+        index += count;
+    }
+}
+
+// Pad the file with zeros to the next payload boundary
+bool align_file(FILE* file, long& position) {
+    static const unsigned char padding[MAP_FILE_ALIGN] = {};
+    long aligned = (position + MAP_FILE_ALIGN - 1) / MAP_FILE_ALIGN * MAP_FILE_ALIGN;
+    if (aligned > position && fwrite(padding, (size_t)(aligned - position), 1, file) != 1) {
+        return false;
+    }
+    position = aligned;
+    return true;
+}
+
+// Write a layer's non-empty chunks followed by its directory
+bool write_layer(FILE* file, long& position, const TileMap& map, bool compress, MapFileLayer& layer) {
+    std::vector<MapFileChunkEntry> entries;
+    std::vector<unsigned char> encoded;
+    bool ok = true;
+
+    map.for_each_chunk([&](int chunk_x, int chunk_y, const uint16_t* tiles) {
+        if (!ok) return;
+        if (std::all_of(tiles, tiles + TileMap::CHUNK_TILES, [](uint16_t tile) { return tile == 0; })) {
+            return;
+        }
+
+        MapFileChunkEntry entry;
+        entry.chunk_x = chunk_x;
+        entry.chunk_y = chunk_y;
+        entry.encoding = TileMap::CHUNK_RAW;
+        const void* payload = tiles;
+        size_t payload_size = RAW_CHUNK_BYTES;
+
+        if (compress) {
+            encode_chunk_rle(tiles, encoded);
+            if (encoded.size() < RAW_CHUNK_BYTES) {
+                entry.encoding = TileMap::CHUNK_RLE;
+                payload = encoded.data();
+                payload_size = encoded.size();
+            }
+        }
+
+        if (!align_file(file, position) || fwrite(payload, payload_size, 1, file) != 1) {
+            ok = false;
+            return;
+        }
+        entry.offset = (uint64_t)position;
+        entry.size = (uint32_t)payload_size;
+        position += (long)payload_size;
+        entries.push_back(entry);
+    });
+
+    if (!ok || !align_file(file, position)) {
+        return false;
+    }
+
+    layer.width = (uint32_t)map.get_width();
+    layer.height = (uint32_t)map.get_height();
+    layer.chunk_count = (uint32_t)entries.size();
+    layer.reserved = 0;
+    layer.directory_offset = (uint64_t)position;
+
+    if (!entries.empty() &&
+        fwrite(entries.data(), sizeof(MapFileChunkEntry), entries.size(), file) != entries.size()) {
+        return false;
+    }
+    position += (long)(entries.size() * sizeof(MapFileChunkEntry));
+    return true;
+}
+
+} // namespace
+
+bool load_tile_map_file(const char* path, TileMap* const* maps, int max_layers, int* layer_count) {
+    if (!path || !maps || max_layers <= 0) {
+        return false;
+    }
+
+    std::shared_ptr<MappedMapFile> file = std::make_shared<MappedMapFile>();
+    if (!file->open(path)) {
+        return false;
+    }
+
+    MapFileHeader header;
+    if (file->size() < sizeof(MapFileHeader)) {
+        std::cerr << "[Runtime] Map file too small: " << path << std::endl;
+        return false;
+    }
+    memcpy(&header, file->data(), sizeof(header));
+    if (memcmp(header.magic, MAP_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != MAP_FILE_VERSION ||
+        header.layer_count == 0 ||
+        header.chunk_size != (uint32_t)TileMap::CHUNK_SIZE) {
+        std::cerr << "[Runtime] Unsupported map file format: " << path << std::endl;
+        return false;
+    }
+    if (header.layer_count > (uint32_t)max_layers) {
+        std::cerr << "[Runtime] Map file has " << header.layer_count << " layers, at most "
+                  << max_layers << " supported: " << path << std::endl;
+        return false;
+    }
+
+    std::vector<MapFileLayer> layers(header.layer_count);
+    size_t table_size = layers.size() * sizeof(MapFileLayer);
+    if (file->size() - sizeof(MapFileHeader) < table_size) {
+        std::cerr << "[Runtime] Map file too small: " << path << std::endl;
+        return false;
+    }
+    memcpy(layers.data(), file->data() + sizeof(MapFileHeader), table_size);
+
+    // Validate every directory before any map is replaced
+    std::vector<std::vector<TileMap::FileChunk>> chunks(layers.size());
+    for (size_t i = 0; i < layers.size(); i++) {
+        if (!read_layer_directory(*file, layers[i], chunks[i])) {
+            std::cerr << "[Runtime] Corrupt chunk directory in map file: " << path << std::endl;
+            return false;
+        }
+    }
+
+    std::cout << "[Runtime] Mapped world map file " << path << ":";
+    for (size_t i = 0; i < layers.size(); i++) {
+        maps[i]->attach_file_chunks((int)layers[i].width, (int)layers[i].height, file, chunks[i]);
+        std::cout << (i ? ", " : " ") << "layer " << i << " " << layers[i].width << "x" << layers[i].height
+                  << " (" << chunks[i].size() << " chunks)";
+    }
+    std::cout << std::endl;
+
+    if (layer_count) {
+        *layer_count = (int)layers.size();
+    }
+    return true;
+}
+
+bool save_tile_map_file(const char* path, const TileMap* const* maps, int layer_count, bool compress) {
+    if (!path || !maps || layer_count <= 0) {
+        return false;
+    }
+
+    // Write beside the target; a mapping of the old file stays valid
+    std::string temp_path = std::string(path) + ".tmp";
+    FILE* file = fopen(temp_path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "[Runtime] Failed to create map file: " << temp_path << std::endl;
+        return false;
+    }
+
+    MapFileHeader header;
+    memcpy(header.magic, MAP_FILE_MAGIC, sizeof(header.magic));
+    header.version = MAP_FILE_VERSION;
+    header.layer_count = (uint32_t)layer_count;
+    header.chunk_size = (uint32_t)TileMap::CHUNK_SIZE;
+
+    // Layer table is rewritten once the directories are placed
+    std::vector<MapFileLayer> layers(layer_count, MapFileLayer());
+    size_t table_size = layers.size() * sizeof(MapFileLayer);
+    long position = (long)(sizeof(header) + table_size);
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(layers.data(), table_size, 1, file) == 1;
+    for (int i = 0; ok && i < layer_count; i++) {
+        ok = write_layer(file, position, *maps[i], compress, layers[i]);
+    }
+    ok = ok &&
+         fseek(file, (long)sizeof(header), SEEK_SET) == 0 &&
+         fwrite(layers.data(), table_size, 1, file) == 1;
+
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    if (!ok || rename(temp_path.c_str(), path) != 0) {
+        std::cerr << "[Runtime] Failed to write map file: " << path << std::endl;
+        remove(temp_path.c_str());
+        return false;
+    }
+
+    std::cout << "[Runtime] Saved world map file " << path << " (" << position << " bytes)" << std::endl;
+    return true;
+}
+
+} // namespace AbstractRuntime
@@ -0,0 +1,200 @@
+#include "tile_renderer.h"
+#include <OpenGL/gl.h>
+#include <iostream>
+#include <algorithm>
+
+namespace AbstractRuntime {
+
+// =============================================================================
+// TILE ATLAS
+// =============================================================================
+
+TileAtlas::TileAtlas()
+    : texture_(0) {
+    std::fill(loaded_, loaded_ + MAX_TILES, false);
+}
+
+TileAtlas::~TileAtlas() {
+    // GL objects are released explicitly via shutdown() while the context exists
+}
+
+bool TileAtlas::initialize() {
+    if (texture_) {
+        return true;
+    }
+
+    glGenTextures(1, &texture_);
+    if (!texture_) {
+        std::cerr << "[Runtime] Failed to create tile atlas texture" << std::endl;
+        return false;
+    }
+
+    // Storage is allocated once and cleared; tiles are sub-uploaded into slots
+    std::vector<unsigned char> empty((size_t)ATLAS_SIZE * ATLAS_SIZE * 4, 0);
+    glBindTexture(GL_TEXTURE_2D, texture_);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, ATLAS_SIZE, ATLAS_SIZE, 0,
+                 GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, empty.data());
+
+    // Nearest filtering keeps neighbouring slots from bleeding into each other
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    std::fill(loaded_, loaded_ + MAX_TILES, false);
+    std::cout << "[Runtime] Tile atlas created: " << ATLAS_SIZE << "x" << ATLAS_SIZE
+              << " (" << SLOTS_PER_ROW * SLOTS_PER_ROW << " slots)" << std::endl;
+    return true;
+}
+
+void TileAtlas::shutdown() {
+    if (texture_) {
+        glDeleteTextures(1, &texture_);
+        texture_ = 0;
+    }
+    std::fill(loaded_, loaded_ + MAX_TILES, false);
+}
+
+void TileAtlas::upload_tile(int tile_id, const unsigned char* pixels, int width, int height, int stride) {
+    if (!texture_ || tile_id <= 0 || tile_id >= MAX_TILES || !pixels) {
+        return;
+    }
+
+    int slot_x = (tile_id % SLOTS_PER_ROW) * TILE_SIZE;
+    int slot_y = (tile_id / SLOTS_PER_ROW) * TILE_SIZE;
+    int copy_width = std::min(width, (int)TILE_SIZE);
+    int copy_height = std::min(height, (int)TILE_SIZE);
+
+    glBindTexture(GL_TEXTURE_2D, texture_);
+
+    // Clear the slot first when the image does not cover all of it
+    if (copy_width < TILE_SIZE || copy_height < TILE_SIZE) {
+        static const std::vector<unsigned char> empty_slot((size_t)TILE_SIZE * TILE_SIZE * 4, 0);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, slot_x, slot_y, TILE_SIZE, TILE_SIZE,
+                        GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, empty_slot.data());
+    }
+
+    if (copy_width > 0 && copy_height > 0) {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, slot_x, slot_y, copy_width, copy_height,
+                        GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, pixels);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    loaded_[tile_id] = true;
+}
+
+void TileAtlas::clear_tile(int tile_id) {
+    if (tile_id > 0 && tile_id < MAX_TILES) {
+        loaded_[tile_id] = false;
+    }
+}
+
+void TileAtlas::get_tile_texcoords(int tile_id, float& u0, float& v0, float& u1, float& v1) const {
+    const float slot = (float)TILE_SIZE / ATLAS_SIZE;
+    u0 = (tile_id % SLOTS_PER_ROW) * slot;
+    v0 = (tile_id / SLOTS_PER_ROW) * slot;
+    u1 = u0 + slot;
+    v1 = v0 + slot;
+}
+
+// =============================================================================
+// TILE BATCH
+// =============================================================================
+
+TileBatch::TileBatch()
+    : first_x_(0)
+    , first_y_(0)
+    , valid_(false)
+    , columns_(0)
+    , rows_(0) {
+}
+
+void TileBatch::build(const TileAtlas& atlas, const TileMap& map, const uint8_t* palette,
+                      int first_x, int first_y, int columns, int rows) {
+    first_x_ = first_x;
+    first_y_ = first_y;
+    valid_ = true;
+    columns_ = std::max(0, columns);
+    rows_ = std::max(0, rows);
+
+    // Cells outside the map read as 0 and are skipped with empty tiles
+    cells_.resize((size_t)columns_ * rows_);
+    map.read_rect(first_x, first_y, columns_, rows_, cells_.data());
+
+    build_quads(atlas, palette);
+}
+
+void TileBatch::refresh(const TileAtlas& atlas, const uint8_t* palette) {
+    if (valid_) {
+        build_quads(atlas, palette);
+    }
+}
+
+void TileBatch::build_quads(const TileAtlas& atlas, const uint8_t* palette) {
+    vertices_.clear();
+
+    const float size = (float)TileAtlas::TILE_SIZE;
+    for (int row = 0; row < rows_; row++) {
+        for (int col = 0; col < columns_; col++) {
+            uint16_t cell = cells_[(size_t)row * columns_ + col];
+            int tile_id = cell & TileMap::ID_MASK;
+            if (tile_id == 0) continue;
+
+            int slot = palette[tile_id];
+            if (!atlas.has_tile(slot)) continue;
+
+            float u0, v0, u1, v1;
+            atlas.get_tile_texcoords(slot, u0, v0, u1, v1);
+            if (cell & TileMap::FLIP_X) std::swap(u0, u1);
+            if (cell & TileMap::FLIP_Y) std::swap(v0, v1);
+
+            // Texture corners for the quad's TL, TR, BR, BL vertices;
+            // rotating clockwise shows the image's BL corner at the TL vertex
+            float corner_u[4] = { u0, u1, u1, u0 };
+            float corner_v[4] = { v0, v0, v1, v1 };
+            int first = (cell & TileMap::ROTATE) ? 3 : 0;
+
+            float x0 = col * size;
+            float y0 = row * size;
+            float x1 = x0 + size;
+            float y1 = y0 + size;
+            const float quad[FLOATS_PER_QUAD] = {
+                x0, y0, corner_u[first], corner_v[first],
+                x1, y0, corner_u[(first + 1) % 4], corner_v[(first + 1) % 4],
+                x1, y1, corner_u[(first + 2) % 4], corner_v[(first + 2) % 4],
+                x0, y1, corner_u[(first + 3) % 4], corner_v[(first + 3) % 4],
+            };
+            vertices_.insert(vertices_.end(), quad, quad + FLOATS_PER_QUAD);
+        }
+    }
+}
+
+void TileBatch::draw(const TileAtlas& atlas, float offset_x, float offset_y) const {
+    if (vertices_.empty() || !atlas.is_initialized()) {
+        return;
+    }
+
+    glPushMatrix();
+    glTranslatef(offset_x, offset_y, 0.0f);
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, atlas.get_texture_id());
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glVertexPointer(2, GL_FLOAT, FLOATS_PER_VERTEX * sizeof(float), &vertices_[0]);
+    glTexCoordPointer(2, GL_FLOAT, FLOATS_PER_VERTEX * sizeof(float), &vertices_[2]);
+    glDrawArrays(GL_QUADS, 0, (GLsizei)(vertices_.size() / FLOATS_PER_VERTEX));
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
+    glPopMatrix();
+}
+
+} // namespace AbstractRuntime